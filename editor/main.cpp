@@ -23,14 +23,54 @@
 
 #include "editor-window.hpp"
 #include <iostream>
+#include <string.h>
 
+/*
+ * Usage: editor [--record FILE] [--replay FILE [--realtime]]
+ *
+ * --record writes the input of the session to FILE, --replay runs a
+ * recorded session instead of the live input, prints the frame
+ * statistics and quits.
+ */
 int main (int argc, char* argv[])
 {
   using namespace BlendInt;
 
+  const char* record_file = 0;
+  const char* replay_file = 0;
+  bool realtime = false;
+
+  for (int i = 1; i < argc; i++) {
+    if ((strcmp(argv[i], "--record") == 0) && ((i + 1) < argc)) {
+      record_file = argv[++i];
+    } else if ((strcmp(argv[i], "--replay") == 0) && ((i + 1) < argc)) {
+      replay_file = argv[++i];
+    } else if (strcmp(argv[i], "--realtime") == 0) {
+      realtime = true;
+    }
+  }
+
   if (Window::Initialize()) {
     EditorWindow win(1280, 800, "UI Editor");
+
+    InputRecorder recorder;
+    if (record_file && recorder.Open(record_file)) {
+      win.set_input_recorder(&recorder);
+    }
+
+    InputReplayer replayer;
+    if (replay_file && replayer.Load(replay_file)) {
+      replayer.set_realtime(realtime);
+      replayer.set_close_when_finished(true);
+      win.set_input_replayer(&replayer);
+    }
+
     win.Exec();
+
+    win.set_input_recorder(0);
+    win.set_input_replayer(0);
+    if (replay_file) replayer.PrintStats(stdout);
+
     Window::Terminate();
   }
 
@@ -0,0 +1,136 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <blendint/core/types.hpp>
+
+namespace BlendInt {
+
+  /**
+   * @brief A lock-free multi-producer single-consumer FIFO queue
+   *
+   * Any thread can Push() without locking: a producer swaps the head
+   * pointer with one atomic exchange and then links the previous node.
+   * Only one thread (the consumer) may Pop().
+   *
+   * The node being linked is not visible to Pop() until the producer
+   * has finished, so Pop() may return false while a Push() is in
+   * progress; the producer is expected to wake up the consumer after
+   * Push() returns.
+   *
+   * T must be default constructible, the queue keeps one empty node
+   * in front of the values.
+   *
+   * @ingroup blendint_core
+   */
+  template<typename T>
+  class MPSCQueue
+  {
+  public:
+
+    MPSCQueue ()
+    {
+      Node* stub = new Node;
+      head_.store(stub);
+      tail_ = stub;
+    }
+
+    ~MPSCQueue ()
+    {
+      T value;
+      while (Pop(&value)) {
+      }
+
+      delete tail_;
+    }
+
+    /**
+     * @brief Append a value, can be called in any thread
+     */
+    void Push (const T& value)
+    {
+      Node* node = new Node(value);
+      Node* previous = head_.exchange(node, std::memory_order_acq_rel);
+      previous->next.store(node, std::memory_order_release);
+    }
+
+    /**
+     * @brief Take the oldest value, in the consumer thread only
+     * @return false if the queue is empty
+     */
+    bool Pop (T* value)
+    {
+      Node* tail = tail_;
+      Node* next = tail->next.load(std::memory_order_acquire);
+
+      if (next == 0) return false;
+
+      // next becomes the empty front node
+      *value = next->value;
+      next->value = T();
+      tail_ = next;
+      delete tail;
+
+      return true;
+    }
+
+    /**
+     * @brief If there's no value, only reliable in the consumer thread
+     */
+    bool empty () const
+    {
+      return tail_->next.load(std::memory_order_acquire) == 0;
+    }
+
+  private:
+
+    struct Node
+    {
+      Node ()
+      : next(0)
+      {
+      }
+
+      explicit Node (const T& v)
+      : value(v), next(0)
+      {
+      }
+
+      T value;
+
+      std::atomic<Node*> next;
+    };
+
+    // the last pushed node, swapped by producers
+    std::atomic<Node*> head_;
+
+    // the empty front node, owned by the consumer
+    Node* tail_;
+
+    DISALLOW_COPY_AND_ASSIGN(MPSCQueue);
+  };
+
+}
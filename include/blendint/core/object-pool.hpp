@@ -0,0 +1,255 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+#include <new>
+#include <typeinfo>
+#include <utility>
+
+#include <blendint/core/types.hpp>
+
+namespace BlendInt {
+
+  /**
+   * @brief A pool of fixed size blocks carved from large chunks
+   *
+   * Allocate() and Deallocate() only push and pop a free list, new
+   * memory is requested from the system one chunk (blocks_per_chunk
+   * blocks) at a time, and all chunks are returned at once when the
+   * pool is destroyed. Building or tearing down thousands of small
+   * objects of one type then costs a handful of heap calls.
+   *
+   * Every pool registers itself so PrintStats() can report the memory
+   * held by each one. A pool is not thread-safe, use it in the thread
+   * which creates and destroys the objects (the main thread).
+   *
+   * @ingroup blendint_core
+   */
+  class FixedPool
+  {
+  public:
+
+    FixedPool (const char* name, size_t block_size, size_t blocks_per_chunk = 256);
+
+    ~FixedPool ();
+
+    void* Allocate ();
+
+    void Deallocate (void* p);
+
+    /**
+     * @brief Return all chunks to the system
+     *
+     * Only valid when no block is in use.
+     */
+    void Release ();
+
+    inline const char* name () const
+    {
+      return name_;
+    }
+
+    inline size_t block_size () const
+    {
+      return block_size_;
+    }
+
+    /**
+     * @brief Blocks currently in use
+     */
+    inline size_t live_count () const
+    {
+      return live_count_;
+    }
+
+    /**
+     * @brief The most blocks in use at the same time
+     */
+    inline size_t peak_count () const
+    {
+      return peak_count_;
+    }
+
+    inline size_t chunk_count () const
+    {
+      return chunk_count_;
+    }
+
+    /**
+     * @brief Bytes requested from the system by this pool
+     */
+    inline size_t reserved_bytes () const
+    {
+      return chunk_count_ * chunk_size_;
+    }
+
+    /**
+     * @brief Print the statistics of all pools alive
+     */
+    static void PrintStats (FILE* fp);
+
+    static const size_t kAlignment = 16;
+
+  private:
+
+    struct FreeBlock
+    {
+      FreeBlock* next;
+    };
+
+    struct Chunk
+    {
+      Chunk* next;
+    };
+
+    void Grow ();
+
+    const char* name_;
+
+    size_t block_size_;
+
+    size_t blocks_per_chunk_;
+
+    size_t chunk_size_;
+
+    Chunk* chunks_;
+
+    FreeBlock* free_blocks_;
+
+    size_t live_count_;
+
+    size_t peak_count_;
+
+    size_t chunk_count_;
+
+    FixedPool* previous_;
+
+    FixedPool* next_;
+
+    static FixedPool* kFirstPool;
+
+    DISALLOW_COPY_AND_ASSIGN(FixedPool);
+  };
+
+  /**
+   * @brief Construct and destroy objects of one type in a FixedPool
+   *
+   * Used as a per-container arena, e.g. for the ModelNode of a model:
+   * the nodes go away with the container in one step.
+   */
+  template<typename T>
+  class ObjectPool
+  {
+  public:
+
+    explicit ObjectPool (const char* name, size_t objects_per_chunk = 256)
+    : pool_(name, sizeof(T), objects_per_chunk)
+    {
+    }
+
+    ~ObjectPool ()
+    {
+    }
+
+    template<typename ... Args>
+    inline T* Construct (Args&& ... args)
+    {
+      return new (pool_.Allocate()) T(std::forward<Args>(args)...);
+    }
+
+    inline void Destroy (T* obj)
+    {
+      if (obj) {
+        obj->~T();
+        pool_.Deallocate(obj);
+      }
+    }
+
+    inline const FixedPool& pool () const
+    {
+      return pool_;
+    }
+
+  private:
+
+    FixedPool pool_;
+
+    DISALLOW_COPY_AND_ASSIGN(ObjectPool);
+  };
+
+  /**
+   * @brief Opt-in class level operator new/delete from a per-type pool
+   *
+   * A class inheriting PoolAllocated<Itself> is allocated from a
+   * FixedPool shared by all instances of the class. Sub classes with a
+   * different size fall back to the global heap, the sized delete
+   * tells them apart (delete through a virtual destructor passes the
+   * size of the most derived class).
+   */
+  template<typename T>
+  class PoolAllocated
+  {
+  public:
+
+    static inline void* operator new (size_t size)
+    {
+      if (size != sizeof(T)) return ::operator new(size);
+      return pool()->Allocate();
+    }
+
+    static inline void operator delete (void* p, size_t size)
+    {
+      if (size != sizeof(T))
+        ::operator delete(p);
+      else
+        pool()->Deallocate(p);
+    }
+
+    /**
+     * @brief The pool of this type
+     *
+     * Never destroyed: objects may still be released by static
+     * destructors at exit.
+     */
+    static FixedPool* pool ()
+    {
+      static FixedPool* pool = new FixedPool(typeid(T).name(), sizeof(T), 128);
+      return pool;
+    }
+
+  protected:
+
+    inline PoolAllocated ()
+    {
+    }
+
+    inline ~PoolAllocated ()
+    {
+    }
+
+  };
+
+}
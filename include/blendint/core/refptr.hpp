@@ -92,6 +92,20 @@ class RefPtr
   template<typename T_CastFrom>
   inline RefPtr (const RefPtr<T_CastFrom>& orig);
 
+  /**
+   * @brief Move constructor
+   * @param orig A RefPtr to take over, it holds nothing afterwards
+   *
+   * The reference is transferred, the reference count is not touched.
+   */
+  inline RefPtr (RefPtr<T>&& orig);
+
+  /**
+   * @brief Move constructor (from different, but castable type)
+   */
+  template<typename T_CastFrom>
+  inline RefPtr (RefPtr<T_CastFrom>&& orig);
+
   /**
    * @brief Destructor
    *
@@ -119,6 +133,20 @@ class RefPtr
   template<typename T_CastFrom>
   inline RefPtr<T>& operator = (const RefPtr<T_CastFrom>& src);
 
+  /**
+   * @brief Move assignment
+   * @param src A RefPtr to take over, it holds nothing afterwards
+   *
+   * Only the reference previously held by this RefPtr is released.
+   */
+  inline RefPtr<T>& operator = (RefPtr<T>&& src);
+
+  /**
+   * @brief Move assignment from different but castable type of RefPtr
+   */
+  template<typename T_CastFrom>
+  inline RefPtr<T>& operator = (RefPtr<T_CastFrom>&& src);
+
   /**
    * @brief Reset the pointer
    * @param obj A new object pointer
@@ -237,6 +265,8 @@ class RefPtr
 
  private:
 
+  template<typename T_CastFrom> friend class RefPtr;
+
   T* ptr_;
 
 };
@@ -269,6 +299,21 @@ inline RefPtr<T>::RefPtr (const RefPtr<T_CastFrom>& orig)
   if (ptr_) ++ptr_->reference_count_;
 }
 
+template<typename T>
+inline RefPtr<T>::RefPtr (RefPtr<T>&& orig)
+    : ptr_(orig.ptr_)
+{
+  orig.ptr_ = 0;
+}
+
+template<typename T>
+template<typename T_CastFrom>
+inline RefPtr<T>::RefPtr (RefPtr<T_CastFrom>&& orig)
+    : ptr_(orig.ptr_)
+{
+  orig.ptr_ = 0;
+}
+
 template<typename T>
 inline RefPtr<T>::~RefPtr ()
 {
@@ -302,6 +347,33 @@ inline RefPtr<T>& RefPtr<T>::operator= (const RefPtr<T_CastFrom>& src)
   return *this;
 }
 
+template<typename T>
+inline RefPtr<T>& RefPtr<T>::operator = (RefPtr<T>&& src)
+{
+  if (&src != this) {
+    T* const old = ptr_;
+    ptr_ = src.ptr_;
+    src.ptr_ = 0;
+
+    if (old && (--old->reference_count_ == 0)) delete old;
+  }
+
+  return *this;
+}
+
+template<class T>
+template<class T_CastFrom>
+inline RefPtr<T>& RefPtr<T>::operator= (RefPtr<T_CastFrom>&& src)
+{
+  T* const old = ptr_;
+  ptr_ = src.ptr_;
+  src.ptr_ = 0;
+
+  if (old && (--old->reference_count_ == 0)) delete old;
+
+  return *this;
+}
+
 template<typename T> inline
 void RefPtr<T>::reset (T* obj)
 {
@@ -319,9 +391,9 @@ inline void RefPtr<T>::reset (const RefPtr<T>& other)
   T* const old = ptr_;
   ptr_ = other.ptr_;
 
-  if (ptr_) ++ptr_->m_count;
+  if (ptr_) ++ptr_->reference_count_;
 
-  if (old && (--old->m_count == 0)) delete old;
+  if (old && (--old->reference_count_ == 0)) delete old;
 }
 
 template<typename T>
@@ -340,6 +412,8 @@ inline RefPtr<T>& RefPtr<T>::swap (RefPtr<T>& other)
   T* const temp = ptr_;
   ptr_ = other.ptr_;
   other.ptr_ = temp;
+
+  return *this;
 }
 
 template<typename T>
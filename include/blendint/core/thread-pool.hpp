@@ -0,0 +1,490 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <blendint/core/types.hpp>
+
+namespace BlendInt {
+
+  enum TaskPriority
+  {
+    TaskPriorityLow = 0,
+    TaskPriorityNormal,
+    TaskPriorityHigh,
+    TaskPriorityCount
+  };
+
+  /**
+   * @brief A flag shared by the copies of a token to cancel tasks
+   *
+   * A task submitted with a cancelled token is not run, and its future
+   * finishes as cancelled. A running task may check cancelled() to
+   * stop early.
+   *
+   * @ingroup blendint_core
+   */
+  class CancellationToken
+  {
+  public:
+
+    CancellationToken ()
+    : cancelled_(new std::atomic<bool>(false))
+    {
+    }
+
+    inline void Cancel ()
+    {
+      cancelled_->store(true);
+    }
+
+    inline bool cancelled () const
+    {
+      return cancelled_->load();
+    }
+
+  private:
+
+    std::shared_ptr<std::atomic<bool> > cancelled_;
+  };
+
+  /**
+   * @brief The state shared by a task and its Future
+   */
+  class FutureStateBase
+  {
+  public:
+
+    FutureStateBase ()
+    : ready_(false), cancelled_(false)
+    {
+    }
+
+    virtual ~FutureStateBase ()
+    {
+    }
+
+    void Wait ();
+
+    /**
+     * @brief Wait, then rethrow the exception the task failed with
+     */
+    void WaitResult ();
+
+    /**
+     * @brief Mark as ready and dispatch the continuation
+     * @param[in] cancelled If the task was not run
+     * @param[in] error The exception thrown by the task, if any
+     */
+    void Finish (bool cancelled,
+                 const std::exception_ptr& error = std::exception_ptr());
+
+    /**
+     * @brief Set the callback dispatched once ready, or dispatch it
+     * now if it's ready already
+     */
+    void SetContinuation (const std::function<void()>& continuation);
+
+    bool ready ();
+
+    bool cancelled ();
+
+    bool failed ();
+
+  private:
+
+    std::mutex mutex_;
+
+    std::condition_variable condition_;
+
+    bool ready_;
+
+    bool cancelled_;
+
+    std::exception_ptr error_;
+
+    std::function<void()> continuation_;
+  };
+
+  template<typename T>
+  class FutureState: public FutureStateBase
+  {
+  public:
+
+    FutureState ()
+    : value()
+    {
+    }
+
+    template<typename F>
+    void Run (F& function)
+    {
+      value = function();
+    }
+
+    T value;
+  };
+
+  template<>
+  class FutureState<void>: public FutureStateBase
+  {
+  public:
+
+    template<typename F>
+    void Run (F& function)
+    {
+      function();
+    }
+  };
+
+  /**
+   * @brief The result of a task submitted to a ThreadPool
+   *
+   * Copies refer to the same result.
+   *
+   * @ingroup blendint_core
+   */
+  template<typename T>
+  class Future
+  {
+  public:
+
+    Future ()
+    {
+    }
+
+    explicit Future (const std::shared_ptr<FutureState<T> >& state)
+    : state_(state)
+    {
+    }
+
+    inline bool valid () const
+    {
+      return state_ ? true : false;
+    }
+
+    inline bool ready () const
+    {
+      return state_->ready();
+    }
+
+    inline bool cancelled () const
+    {
+      return state_->cancelled();
+    }
+
+    /**
+     * @brief If the task threw an exception
+     */
+    inline bool failed () const
+    {
+      return state_->failed();
+    }
+
+    inline void Wait () const
+    {
+      state_->Wait();
+    }
+
+    /**
+     * @brief Wait and return the result, a default value if cancelled
+     *
+     * Rethrows the exception if the task failed. Waiting in the main
+     * thread blocks the UI, prefer Then(). A task waiting for another
+     * one holds its worker meanwhile.
+     */
+    const T& Get () const
+    {
+      state_->WaitResult();
+      return state_->value;
+    }
+
+    /**
+     * @brief Call back with the result in the main thread
+     *
+     * Not called if the task was cancelled or failed. See
+     * ThreadPool::SetMainThreadDispatcher().
+     */
+    void Then (const std::function<void(const T&)>& callback) const
+    {
+      std::shared_ptr<FutureState<T> > state = state_;
+      state_->SetContinuation([state, callback] () {
+        if (!(state->cancelled() || state->failed())) callback(state->value);
+      });
+    }
+
+  private:
+
+    std::shared_ptr<FutureState<T> > state_;
+  };
+
+  template<>
+  class Future<void>
+  {
+  public:
+
+    Future ()
+    {
+    }
+
+    explicit Future (const std::shared_ptr<FutureState<void> >& state)
+    : state_(state)
+    {
+    }
+
+    inline bool valid () const
+    {
+      return state_ ? true : false;
+    }
+
+    inline bool ready () const
+    {
+      return state_->ready();
+    }
+
+    inline bool cancelled () const
+    {
+      return state_->cancelled();
+    }
+
+    /**
+     * @brief If the task threw an exception
+     */
+    inline bool failed () const
+    {
+      return state_->failed();
+    }
+
+    inline void Wait () const
+    {
+      state_->Wait();
+    }
+
+    inline void Get () const
+    {
+      state_->WaitResult();
+    }
+
+    void Then (const std::function<void()>& callback) const
+    {
+      std::shared_ptr<FutureState<void> > state = state_;
+      state_->SetContinuation([state, callback] () {
+        if (!(state->cancelled() || state->failed())) callback();
+      });
+    }
+
+  private:
+
+    std::shared_ptr<FutureState<void> > state_;
+  };
+
+  /**
+   * @brief A work-stealing thread pool for background work
+   *
+   * Every worker has its own queues, one per priority. Tasks submitted
+   * by a worker go to its own queues and are taken from the back (most
+   * recent first), other tasks are spread over the workers. An idle
+   * worker steals the oldest task from the others, higher priorities
+   * first.
+   *
+   * Continuations set by Future::Then() run in the main thread through
+   * the dispatcher set by SetMainThreadDispatcher(), Window installs
+   * AbstractWindow::PostToUIThread().
+   *
+   * @ingroup blendint_core
+   */
+  class ThreadPool
+  {
+  public:
+
+    /**
+     * @brief Constructor
+     * @param[in] workers The number of worker threads, 0 for one less
+     * than the number of cores (at least 1)
+     */
+    explicit ThreadPool (unsigned int workers = 0);
+
+    /**
+     * @brief Destructor, runs the queued tasks and joins the workers
+     */
+    ~ThreadPool ();
+
+    template<typename F>
+    Future<typename std::result_of<F()>::type> Submit (
+        F function,
+        TaskPriority priority = TaskPriorityNormal,
+        const CancellationToken& token = CancellationToken());
+
+    inline unsigned int worker_count () const
+    {
+      return (unsigned int) workers_.size();
+    }
+
+    /**
+     * @brief The number of tasks finished, including cancelled ones
+     */
+    inline unsigned int finished_count () const
+    {
+      return finished_count_.load();
+    }
+
+    /**
+     * @brief The number of tasks run by a worker other than the one
+     * they were queued to
+     */
+    inline unsigned int stolen_count () const
+    {
+      return stolen_count_.load();
+    }
+
+    /**
+     * @brief Average time in milliseconds from submitting to starting
+     * a task
+     */
+    double GetAverageLatency () const;
+
+    /**
+     * @brief Average time in milliseconds to run a task
+     */
+    double GetAverageRunTime () const;
+
+    /**
+     * @brief Create the shared pool
+     * @param[in] workers See ThreadPool()
+     */
+    static void Initialize (unsigned int workers = 0);
+
+    static void Release ();
+
+    /**
+     * @brief The shared pool created by Initialize()
+     */
+    static inline ThreadPool* global ()
+    {
+      return kGlobal;
+    }
+
+    /**
+     * @brief Set the function to run continuations in the main thread
+     *
+     * If not set, continuations run in the worker finishing the task.
+     */
+    static void SetMainThreadDispatcher (
+        const std::function<void(const std::function<void()>&)>& dispatcher);
+
+    static void DispatchToMainThread (const std::function<void()>& task);
+
+  private:
+
+    struct Job
+    {
+      std::function<void()> function;
+
+      std::chrono::steady_clock::time_point submitted;
+    };
+
+    struct Worker
+    {
+      std::mutex mutex;
+
+      std::deque<Job> queues[TaskPriorityCount];
+
+      std::thread thread;
+    };
+
+    void Push (const std::function<void()>& function, TaskPriority priority);
+
+    bool Pop (unsigned int index, Job* job);
+
+    void Run (unsigned int index);
+
+    std::vector<Worker*> workers_;
+
+    // guards sleeping and waking up
+    std::mutex mutex_;
+
+    std::condition_variable condition_;
+
+    std::atomic<int> queued_count_;
+
+    std::atomic<unsigned int> next_worker_;
+
+    std::atomic<unsigned int> finished_count_;
+
+    std::atomic<unsigned int> stolen_count_;
+
+    // in microseconds
+    std::atomic<unsigned long long> total_latency_;
+
+    std::atomic<unsigned long long> total_run_time_;
+
+    bool stopping_;
+
+    static ThreadPool* kGlobal;
+
+    static std::function<void(const std::function<void()>&)> kDispatcher;
+
+    DISALLOW_COPY_AND_ASSIGN(ThreadPool);
+  };
+
+  template<typename F>
+  Future<typename std::result_of<F()>::type> ThreadPool::Submit (
+      F function, TaskPriority priority, const CancellationToken& token)
+  {
+    typedef typename std::result_of<F()>::type T;
+
+    std::shared_ptr<FutureState<T> > state(new FutureState<T>);
+
+    Push([state, function, token] () mutable {
+      if (token.cancelled()) {
+        state->Finish(true);
+        return;
+      }
+
+      // an exception must not escape the worker thread
+      try {
+        state->Run(function);
+      } catch (...) {
+        state->Finish(false, std::current_exception());
+        return;
+      }
+
+      state->Finish(false);
+    }, priority);
+
+    return Future<T>(state);
+  }
+
+}
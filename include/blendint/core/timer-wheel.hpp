@@ -0,0 +1,173 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <chrono>
+
+#include <blendint/core/types.hpp>
+
+namespace BlendInt {
+
+  class Timer;
+
+  /**
+   * @brief A hierarchical timer wheel driving all Timer objects
+   *
+   * Timers are kept in intrusive lists in 4 levels of 64 slots with a
+   * resolution of 1 millisecond, so starting and stopping a timer is
+   * O(1) regardless of the number of timers. A timer far in the future
+   * is moved down one level at a time while the wheel turns.
+   *
+   * The wheel does not own a thread: the event loop calls Advance() to
+   * fire the due timers in its own thread, and GetWaitTimeout() tells
+   * how long it may sleep. All methods must be called in the same
+   * thread (the main thread).
+   *
+   * @ingroup blendint_core
+   */
+  class TimerWheel
+  {
+  public:
+
+    typedef std::chrono::steady_clock Clock;
+
+    TimerWheel ();
+
+    ~TimerWheel ();
+
+    /**
+     * @brief Schedule a timer to fire one interval from now
+     */
+    void Schedule (Timer* timer);
+
+    /**
+     * @brief Remove a scheduled timer, does nothing if it's not
+     */
+    void Cancel (Timer* timer);
+
+    /**
+     * @brief Fire all timers due at the current time
+     */
+    void Advance ();
+
+    /**
+     * @brief Time to the next timer due
+     * @return Seconds to wait, 0 if a timer is due, or a negative value
+     * if no timer is scheduled
+     *
+     * The result may be earlier than the next timer when it is beyond
+     * the lowest level of the wheel, the loop just wakes up and waits
+     * again.
+     */
+    double GetWaitTimeout () const;
+
+    void ResetStats ();
+
+    /**
+     * @brief The number of scheduled timers
+     */
+    inline unsigned int size () const
+    {
+      return size_;
+    }
+
+    inline unsigned int fired_count () const
+    {
+      return fired_count_;
+    }
+
+    /**
+     * @brief The number of timeouts skipped because the loop was late
+     * by more than an interval
+     */
+    inline unsigned int missed_count () const
+    {
+      return missed_count_;
+    }
+
+    /**
+     * @brief Average time in milliseconds a timeout fired after its
+     * due time
+     */
+    inline double average_lateness () const
+    {
+      return fired_count_ > 0 ? total_lateness_ / fired_count_ : 0.0;
+    }
+
+    inline double max_lateness () const
+    {
+      return max_lateness_;
+    }
+
+    static const int kLevels = 4;
+
+    static const int kSlotBits = 6;
+
+    static const int kSlots = 1 << kSlotBits;
+
+  private:
+
+    // milliseconds since the wheel was created
+    uint64_t GetTicks () const;
+
+    // the level and slot are chosen by the expire tick of the timer
+    void Insert (Timer* timer);
+
+    void Unlink (Timer* timer);
+
+    void Cascade (int level);
+
+    Timer** head (int level, int slot)
+    {
+      return level < kLevels ? &slots_[level][slot] : &firing_;
+    }
+
+    Timer* slots_[kLevels][kSlots];
+
+    // a bit for each non-empty slot
+    uint64_t masks_[kLevels];
+
+    // the timers of the slot being fired
+    Timer* firing_;
+
+    // all ticks up to this one were processed
+    uint64_t current_;
+
+    Clock::time_point start_;
+
+    unsigned int size_;
+
+    unsigned int fired_count_;
+
+    unsigned int missed_count_;
+
+    double total_lateness_;
+
+    double max_lateness_;
+
+    DISALLOW_COPY_AND_ASSIGN(TimerWheel);
+  };
+
+}
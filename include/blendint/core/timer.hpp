@@ -23,32 +23,24 @@
 
 #pragma once
 
-#include <signal.h>
 #include <time.h>
 
 #include <blendint/cppevent/event.hpp>
 #include <blendint/core/object.hpp>
 
-/*
-  #ifdef __LINUX__
-  #define BLENDINT_USE_POSIX_TIMER 1
-  #else
-  #define BLENDINT_USE_POSIX_TIMER 0
-  #include <pthread.h>
-  #endif
-*/
-
-// use posix timer cause segment fault in Linux, this is a temporary
-// workaround:
-#define BLENDINT_USE_POSIX_TIMER 0
-
 namespace BlendInt {
 
+class TimerWheel;
+
 /**
  * @brief The timer class
  *
  * The Timer class provides timers which will fire event when time out.
  *
+ * Timers are driven by the TimerWheel returned by wheel(), the event
+ * loop of the main window fires the timeout() events in the main
+ * thread. Start and stop timers in the main thread only.
+ *
  * To use it, create a timer and connect the timeout() event to the appropriate event callee,
  * and call Start() to enable the timer.
  *
@@ -139,6 +131,11 @@ class Timer: public Object
 
   static void SaveProgramTime ();
 
+  /**
+   * @brief The timer wheel of all timers
+   */
+  static TimerWheel* wheel ();
+
   static inline uint64_t saved_time ()
   {
     return kSavedTime;
@@ -151,12 +148,6 @@ class Timer: public Object
 
  protected:
 
-#if BLENDINT_USE_POSIX_TIMER
-  static void ThreadCallback (union sigval sigev_value);
-#else
-  static void *ThreadCallback (void* data);
-#endif
-
   void set_interval (unsigned int interval)
   {
     interval_ = interval;
@@ -164,17 +155,7 @@ class Timer: public Object
 
  private:
 
-#if BLENDINT_USE_POSIX_TIMER
-
-  void Create ();
-
-  timer_t m_id;
-
-#else
-
-  pthread_t m_id;	// thread id
-
-#endif  // BLENDINT_USE_POSIX_TIMER
+  friend class TimerWheel;
 
   /**
    * @brief the interval time in millisecond
@@ -190,6 +171,18 @@ class Timer: public Object
    */
   CppEvent::Event<> timeout_;
 
+  // the tick this timer fires at, see TimerWheel
+  uint64_t expires_;
+
+  Timer* wheel_previous_;
+
+  Timer* wheel_next_;
+
+  // -1 if not scheduled
+  int wheel_level_;
+
+  int wheel_slot_;
+
   static uint64_t kSavedTime;
 
   static uint64_t kProgramTime;
@@ -0,0 +1,96 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <atomic>
+
+#include <blendint/core/types.hpp>
+
+namespace BlendInt {
+
+  /**
+   * @brief A file descriptor to wake up an event loop waiting in poll()
+   *
+   * Uses an eventfd in Linux and a pipe in other Unix systems. Signal()
+   * writes to the descriptor only once until the loop calls Clear(), so
+   * any number of requests between two iterations of the loop cost one
+   * wakeup.
+   *
+   * @ingroup blendint_core
+   */
+  class WakeupSignal
+  {
+  public:
+
+    WakeupSignal ();
+
+    ~WakeupSignal ();
+
+    /**
+     * @brief Wake up the loop, can be called in any thread
+     * @return true if the descriptor was written
+     */
+    bool Signal ();
+
+    /**
+     * @brief Consume the signal, in the loop thread
+     */
+    void Clear ();
+
+    /**
+     * @brief The descriptor to poll for reading, -1 if not supported
+     */
+    inline int fd () const
+    {
+      return fds_[0];
+    }
+
+    inline unsigned int request_count () const
+    {
+      return request_count_.load();
+    }
+
+    /**
+     * @brief The number of actual writes to the descriptor
+     */
+    inline unsigned int signal_count () const
+    {
+      return signal_count_.load();
+    }
+
+  private:
+
+    std::atomic<bool> signaled_;
+
+    std::atomic<unsigned int> request_count_;
+
+    std::atomic<unsigned int> signal_count_;
+
+    // read and write ends, the same eventfd in Linux
+    int fds_[2];
+
+    DISALLOW_COPY_AND_ASSIGN(WakeupSignal);
+  };
+
+}
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <cppevent/memory-pool.hpp>
+
 #ifdef DEBUG
 #include <cassert>
 #endif
@@ -36,6 +38,7 @@ namespace CppEvent {
 class AbstractTrackable;
 struct Token;
 struct Binding;
+struct ConnectionState;
 
 /**
  * @brief The abstract event binding
@@ -52,6 +55,16 @@ struct Binding
 
   ~Binding ();
 
+  static inline void* operator new (size_t size)
+  {
+    return MemoryPool::Allocate(size);
+  }
+
+  static inline void operator delete (void* p, size_t size)
+  {
+    MemoryPool::Deallocate(p, size);
+  }
+
   AbstractTrackable* trackable_object;
   Binding* previous;
   Binding* next;
@@ -67,17 +80,48 @@ struct Token
       : trackable_object(0),
         previous(0),
         next(0),
-        binding(0)
+        binding(0),
+        target(0),
+        state(0)
   {
   }
 
   virtual ~Token ();
 
+  /**
+   * @brief Unlink from the trackable object (the event) right now
+   *
+   * Called by ~Token(), a subclass which must not be reached through
+   * the event while its own members are torn down calls it first.
+   */
+  void Detach ();
+
+  // Sized delete: the virtual destructor passes the size of the most
+  // derived token, so every DelegateToken/EventToken lands in its own
+  // size class.
+  static inline void* operator new (size_t size)
+  {
+    return MemoryPool::Allocate(size);
+  }
+
+  static inline void operator delete (void* p, size_t size)
+  {
+    MemoryPool::Deallocate(p, size);
+  }
+
   AbstractTrackable* trackable_object;
   Token* previous;
   Token* next;
   Binding* binding;
 
+  // the object or event this token calls into, kept in the base so
+  // it is still readable while the token is being destroyed
+  const void* target;
+
+  // shared with Connection handles, only created by
+  // Event::ConnectWithHandle()
+  ConnectionState* state;
+
 };
 
 /**
@@ -0,0 +1,111 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Freeman Zhang <zhanggyb@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cppevent/memory-pool.hpp>
+
+namespace CppEvent {
+
+// forward declaration
+struct Token;
+
+/**
+ * @brief Shared state between a token and the Connection handles to it
+ *
+ * The token clears the pointer when it is destroyed (disconnected or
+ * its event/trackable went away), so a handle never dangles.
+ */
+struct ConnectionState
+{
+  inline ConnectionState ()
+      : token(0), ref_count(0)
+  {
+  }
+
+  static inline void* operator new (size_t size)
+  {
+    return MemoryPool::Allocate(size);
+  }
+
+  static inline void operator delete (void* p, size_t size)
+  {
+    MemoryPool::Deallocate(p, size);
+  }
+
+  static void Retain (ConnectionState* state);
+
+  static void Release (ConnectionState* state);
+
+  Token* token;
+  unsigned int ref_count;
+};
+
+/**
+ * @brief Lightweight handle returned by Event::ConnectWithHandle
+ *
+ * Disconnect() removes exactly the connection it was created for in
+ * O(1), without searching the event. Copies share the same state,
+ * destroying a handle does not disconnect.
+ *
+ * Like the rest of CppEvent this is not thread-safe: use handles in
+ * the thread which owns the event.
+ */
+class Connection
+{
+  template<typename ... ParamTypes> friend class Event;
+
+ public:
+
+  inline Connection ()
+      : state_(0)
+  {
+  }
+
+  Connection (const Connection& orig);
+
+  ~Connection ();
+
+  Connection& operator = (const Connection& orig);
+
+  /**
+   * @brief Disconnect if still connected, the handle becomes empty
+   */
+  void Disconnect ();
+
+  bool connected () const
+  {
+    return state_ && state_->token;
+  }
+
+ private:
+
+  explicit Connection (Token* token);
+
+  ConnectionState* state_;
+};
+
+}  // namespace CppEvent
@@ -42,7 +42,7 @@ class DelegateToken : public InvokableToken < ParamTypes... >
 
   virtual ~DelegateToken();
 
-  virtual void Invoke(ParamTypes... Args) override;
+  virtual void Invoke(typename ParamTraits<ParamTypes>::ParamType... Args) override;
 
   const Delegate<void, ParamTypes...>& delegate () const
   {
@@ -57,7 +57,7 @@ class DelegateToken : public InvokableToken < ParamTypes... >
 
 template<typename ... ParamTypes>
 inline DelegateToken<ParamTypes...>::DelegateToken(const Delegate<void, ParamTypes...>& d)
-    : InvokableToken<ParamTypes...>(), delegate_(d)
+    : InvokableToken<ParamTypes...>(d.object_pointer()), delegate_(d)
 {
 }
 
@@ -67,7 +67,7 @@ DelegateToken<ParamTypes...>::~DelegateToken()
 }
 
 template<typename ... ParamTypes>
-void DelegateToken<ParamTypes...>::Invoke(ParamTypes... Args)
+void DelegateToken<ParamTypes...>::Invoke(typename ParamTraits<ParamTypes>::ParamType... Args)
 {
   delegate_(Args...);
 }
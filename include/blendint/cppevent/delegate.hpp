@@ -28,6 +28,8 @@
 
 #include <string.h>
 
+#include <cppevent/param-traits.hpp>
+
 namespace CppEvent {
 
 // generic classes to calculate method pointer:
@@ -48,7 +50,7 @@ typedef void (GenericMultiInherit::*GenericMethodPointer)();
 template<typename ReturnType, typename ... ParamTypes>
 class Delegate
 {
-  typedef ReturnType (*MethodStubType) (void* object_ptr, GenericMethodPointer, ParamTypes...);
+  typedef ReturnType (*MethodStubType) (void* object_ptr, GenericMethodPointer, typename ParamTraits<ParamTypes>::ParamType...);
 
   struct PointerData
   {
@@ -81,10 +83,10 @@ class Delegate
   template<typename T, typename TFxn>
   struct MethodStub
   {
-    static void invoke (void* obj_ptr, GenericMethodPointer any, ParamTypes ... Args)
+    static ReturnType invoke (void* obj_ptr, GenericMethodPointer any, typename ParamTraits<ParamTypes>::ParamType ... Args)
     {
       T* obj = static_cast<T*>(obj_ptr);
-      (obj->*reinterpret_cast<TFxn>(any))(Args...);
+      return (obj->*reinterpret_cast<TFxn>(any))(Args...);
     }
   };
 
@@ -135,16 +137,21 @@ class Delegate
     return *this;
   }
   
-  inline ReturnType operator () (ParamTypes... Args) const
+  inline ReturnType operator () (typename ParamTraits<ParamTypes>::ParamType... Args) const
   {
     return (*data_.method_stub)(data_.object_pointer, data_.method_pointer, Args...);
   }
   
-  inline ReturnType invoke(ParamTypes... Args) const
+  inline ReturnType invoke(typename ParamTraits<ParamTypes>::ParamType... Args) const
   {
     return (*data_.method_stub)(data_.object_pointer, data_.method_pointer, Args...);
   }
   
+  inline void* object_pointer () const
+  {
+    return data_.object_pointer;
+  }
+
   inline operator bool () const
   {
     // Support method delegate only, no need to check other members:
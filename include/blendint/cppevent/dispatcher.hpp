@@ -0,0 +1,159 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Freeman Zhang <zhanggyb@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+
+namespace CppEvent {
+
+/**
+ * @brief How a connected method is called when the event is invoked
+ */
+enum ConnectionMode
+{
+  /** Call the method in the invoking thread (default) */
+  DirectConnection,
+
+  /** Post every invocation to the dispatcher of the target thread */
+  QueuedConnection,
+
+  /**
+   * Like QueuedConnection, but an invocation still waiting in the
+   * queue is replaced by the newer one: latest value wins
+   */
+  CoalescedConnection
+};
+
+/**
+ * @brief The queue of a target thread used by queued connections
+ *
+ * A sub class pushes tasks to the queue of the thread which owns the
+ * receivers (usually the UI thread). Post() is called from the
+ * producer's thread and must never block: return false when the
+ * queue is full and the invocation is dropped.
+ *
+ * A dispatcher must outlive the connections using it.
+ */
+class AbstractDispatcher
+{
+ public:
+
+  AbstractDispatcher ();
+
+  virtual ~AbstractDispatcher ();
+
+  /**
+   * @brief Post a task and count it as queued or dropped
+   */
+  bool Dispatch (const std::function<void()>& task);
+
+  inline void count_coalesced ()
+  {
+    coalesced_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  inline void count_dropped ()
+  {
+    dropped_count_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Invocations posted to the target thread
+   */
+  inline size_t queued_count () const
+  {
+    return queued_count_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Invocations merged into one still pending
+   */
+  inline size_t coalesced_count () const
+  {
+    return coalesced_count_.load(std::memory_order_relaxed);
+  }
+
+  /**
+   * @brief Invocations rejected by a full queue or whose connection
+   * was gone when they were run
+   */
+  inline size_t dropped_count () const
+  {
+    return dropped_count_.load(std::memory_order_relaxed);
+  }
+
+ protected:
+
+  virtual bool Post (const std::function<void()>& task) = 0;
+
+ private:
+
+  AbstractDispatcher (const AbstractDispatcher& orig);
+
+  AbstractDispatcher& operator = (const AbstractDispatcher& orig);
+
+  std::atomic<size_t> queued_count_;
+  std::atomic<size_t> coalesced_count_;
+  std::atomic<size_t> dropped_count_;
+};
+
+/**
+ * @brief State shared by a queued token and the tasks it posted
+ *
+ * The token clears connected when it is destroyed, tasks still in the
+ * queue then do nothing. latest holds the pending call of a coalesced
+ * connection and is guarded by a spin lock, as the producer only ever
+ * holds it to swap a std::function.
+ */
+struct QueuedState
+{
+  inline QueuedState ()
+      : connected(true), pending(false)
+  {
+    lock.clear();
+  }
+
+  inline void Lock ()
+  {
+    while (lock.test_and_set(std::memory_order_acquire)) {
+    }
+  }
+
+  inline void Unlock ()
+  {
+    lock.clear(std::memory_order_release);
+  }
+
+  std::atomic<bool> connected;
+  std::atomic_flag lock;
+  bool pending;
+  std::function<void()> latest;
+};
+
+}  // namespace CppEvent
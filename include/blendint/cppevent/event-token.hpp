@@ -44,7 +44,7 @@ public:
 
   virtual ~EventToken();
 
-  virtual void Invoke(ParamTypes... Args) override;
+  virtual void Invoke(typename ParamTraits<ParamTypes>::ParamType... Args) override;
 
   inline const Event<ParamTypes...>* event () const;
 
@@ -56,7 +56,7 @@ private:
 template<typename ... ParamTypes>
 inline EventToken<ParamTypes...>::EventToken (Event<
     ParamTypes...>& event)
-    : InvokableToken<ParamTypes...>(), event_(&event)
+    : InvokableToken<ParamTypes...>(&event), event_(&event)
 {
 }
 
@@ -66,7 +66,7 @@ EventToken<ParamTypes...>::~EventToken()
 }
 
 template<typename ... ParamTypes>
-void EventToken<ParamTypes...>::Invoke(ParamTypes... Args)
+void EventToken<ParamTypes...>::Invoke(typename ParamTraits<ParamTypes>::ParamType... Args)
 {
   event_->Invoke(Args...);
 }
@@ -26,9 +26,14 @@
 
 #pragma once
 
+#include <mutex>
+#include <unordered_map>
+
 #include <cppevent/abstract-trackable.hpp>
+#include <cppevent/connection.hpp>
 #include <cppevent/delegate-token.hpp>
 #include <cppevent/event-token.hpp>
+#include <cppevent/queued-token.hpp>
 
 namespace CppEvent {
 
@@ -69,8 +74,46 @@ class Event: public AbstractTrackable
   template<typename T>
   void Connect (T* obj, void (T::*method) (ParamTypes...));
 
+  /**
+   * @brief Connect to a method which is called in another thread
+   *
+   * With QueuedConnection or CoalescedConnection, Invoke() posts the
+   * call to dispatcher (the queue of the thread owning obj) and
+   * returns immediately. DirectConnection or a null dispatcher is the
+   * same as Connect(obj, method).
+   *
+   * The first queued connection gives this event a lock, from then on
+   * Invoke() and every change of the connections hold it. So obj can
+   * be destroyed or disconnected in its own thread while a producer
+   * thread invokes. Make the first queued connection before the event
+   * is invoked in another thread, and do not destroy the event itself
+   * while it may be invoked. Direct connections of such an event are
+   * still called in the producer thread.
+   */
+  template<typename T>
+  void Connect (T* obj, void (T::*method) (ParamTypes...),
+                AbstractDispatcher* dispatcher,
+                ConnectionMode mode = QueuedConnection);
+
   void Connect (Event<ParamTypes...>& other);
 
+  /**
+   * @brief Connect, and return a handle which disconnects this very
+   * connection later in O(1)
+   *
+   * The handle shares a small state with the connection, use Connect()
+   * when no handle is needed.
+   */
+  template<typename T>
+  Connection ConnectWithHandle (T* obj, void (T::*method) (ParamTypes...));
+
+  template<typename T>
+  Connection ConnectWithHandle (T* obj, void (T::*method) (ParamTypes...),
+                                AbstractDispatcher* dispatcher,
+                                ConnectionMode mode = QueuedConnection);
+
+  Connection ConnectWithHandle (Event<ParamTypes...>& other);
+
   /**
    * @brief Disconnect the last delegate to a method
    */
@@ -97,7 +140,13 @@ class Event: public AbstractTrackable
 
   void DisconnectFromEvents ();
 
-  virtual void Invoke (ParamTypes ... Args);
+  /**
+   * @brief Invoke all connected delegates and events
+   *
+   * Heavy arguments are bound by const reference (see ParamTraits)
+   * and handed to each listener without intermediate copies.
+   */
+  virtual void Invoke (typename ParamTraits<ParamTypes>::ParamType ... Args);
 
  protected:
 
@@ -113,12 +162,45 @@ class Event: public AbstractTrackable
 
  private:
 
+  typedef std::unordered_multimap<const void*, Token*> TokenIndex;
+
+  template<typename T>
+  DelegateToken<ParamTypes...>* FindDelegateToken (T* obj, void (T::*method) (ParamTypes...)) const;
+
+  EventToken<ParamTypes...>* FindEventToken (const Event<ParamTypes...>* other) const;
+
+  void IndexToken (Token* token);
+
+  void BuildIndex ();
+
+  inline void Lock ()
+  {
+    if (guard_) guard_->lock();
+  }
+
+  inline void Unlock ()
+  {
+    if (guard_) guard_->unlock();
+  }
+
   Token* first_token_;
   Token* last_token_;
 
   Token* iterator_;  // a pointer to iterate through all connections
   bool iterator_removed_;
 
+  int token_count_;
+
+  // target -> tokens, only built once token_count_ reaches
+  // kIndexThreshold, small events just walk the list
+  TokenIndex* index_;
+
+  // only created by the first queued connection, recursive as a
+  // listener may connect or disconnect in Invoke()
+  std::recursive_mutex* guard_;
+
+  static const int kIndexThreshold = 16;
+
 };
 
 // EventRef declaration:
@@ -152,6 +234,28 @@ public:
     event_->Connect(obj, method);
   }
 
+  template<typename T>
+  inline void connect (T* obj, void (T::*method)(ParamTypes...),
+                       AbstractDispatcher* dispatcher,
+                       ConnectionMode mode = QueuedConnection)
+  {
+    event_->Connect(obj, method, dispatcher, mode);
+  }
+
+  template<typename T>
+  inline Connection connect_with_handle (T* obj, void (T::*method)(ParamTypes...))
+  {
+    return event_->ConnectWithHandle(obj, method);
+  }
+
+  template<typename T>
+  inline Connection connect_with_handle (T* obj, void (T::*method)(ParamTypes...),
+                                         AbstractDispatcher* dispatcher,
+                                         ConnectionMode mode = QueuedConnection)
+  {
+    return event_->ConnectWithHandle(obj, method, dispatcher, mode);
+  }
+
   template<typename T>
   inline void disconnect1 (T* obj, void (T::*method)(ParamTypes...))
   {
@@ -168,6 +272,11 @@ public:
   {
     event_->Connect(event);
   }
+
+  inline Connection connect_with_handle (Event<ParamTypes...>& event)
+  {
+    return event_->ConnectWithHandle(event);
+  }
   
   inline void disconnect1 (Event<ParamTypes...>& event)
   {
@@ -184,6 +293,11 @@ public:
     event_->Connect(*other.event_);
   }
 
+  inline Connection connect_with_handle (const EventRef<ParamTypes...>& other)
+  {
+    return event_->ConnectWithHandle(*other.event_);
+  }
+
   inline void disconnect1 (const EventRef<ParamTypes...>& other)
   {
     event_->Disconnect1(*other.event_);
@@ -207,7 +321,10 @@ inline Event<ParamTypes...>::Event ()
       first_token_(0),
       last_token_(0),
       iterator_(0),
-      iterator_removed_(false)
+      iterator_removed_(false),
+      token_count_(0),
+      index_(0),
+      guard_(0)
 {
 }
 
@@ -215,6 +332,8 @@ template<typename ... ParamTypes>
 Event<ParamTypes...>::~Event ()
 {
   RemoveAllTokens();
+  delete index_;
+  delete guard_;
 }
 
 template<typename ... ParamTypes>
@@ -234,6 +353,32 @@ void Event<ParamTypes...>::Connect (T* obj, void (T::*method) (ParamTypes...))
   add_binding(obj, downstream);
 }
 
+template<typename ... ParamTypes>
+template<typename T>
+void Event<ParamTypes...>::Connect (T* obj, void (T::*method) (ParamTypes...),
+                                    AbstractDispatcher* dispatcher,
+                                    ConnectionMode mode)
+{
+  if ((dispatcher == 0) || (mode == DirectConnection)) {
+    Connect(obj, method);
+    return;
+  }
+
+  Binding* downstream = new Binding;
+
+  Delegate<void, ParamTypes...> d =
+      Delegate<void, ParamTypes...>::template from_method<T>(obj, method);
+  QueuedToken<ParamTypes...>* upstream = new QueuedToken<
+    ParamTypes...>(d, dispatcher, mode);
+
+  if (guard_ == 0) guard_ = new std::recursive_mutex;
+
+  link(upstream, downstream);
+
+  this->PushBackToken(upstream);
+  add_binding(obj, downstream);
+}
+
 template<typename ... ParamTypes>
 void Event<ParamTypes...>::Connect (Event<ParamTypes...>& other)
 {
@@ -245,18 +390,39 @@ void Event<ParamTypes...>::Connect (Event<ParamTypes...>& other)
   add_binding(&other, downstream);
 }
 
+// Connect() always appends, so the new token is the last one
+
+template<typename ... ParamTypes>
+template<typename T>
+Connection Event<ParamTypes...>::ConnectWithHandle (T* obj, void (T::*method) (ParamTypes...))
+{
+  Connect(obj, method);
+  return Connection(last_token_);
+}
+
+template<typename ... ParamTypes>
+template<typename T>
+Connection Event<ParamTypes...>::ConnectWithHandle (T* obj, void (T::*method) (ParamTypes...),
+                                                    AbstractDispatcher* dispatcher,
+                                                    ConnectionMode mode)
+{
+  Connect(obj, method, dispatcher, mode);
+  return Connection(last_token_);
+}
+
+template<typename ... ParamTypes>
+Connection Event<ParamTypes...>::ConnectWithHandle (Event<ParamTypes...>& other)
+{
+  Connect(other);
+  return Connection(last_token_);
+}
+
 template<typename ... ParamTypes>
 template<typename T>
 void Event<ParamTypes...>::Disconnect1 (T* obj, void (T::*method) (ParamTypes...))
 {
-  DelegateToken<ParamTypes...>* conn = 0;
-  for (Token* p = last_token_; p; p = p->previous) {
-    conn = dynamic_cast<DelegateToken<ParamTypes...>*>(p);
-    if (conn && (conn->delegate().template equal<T>(obj, method))) {
-      delete conn;
-      break;
-    }
-  }
+  DelegateToken<ParamTypes...>* conn = FindDelegateToken(obj, method);
+  if (conn) delete conn;
 }
 
 template<typename ... ParamTypes>
@@ -264,34 +430,23 @@ template<typename T>
 void Event<ParamTypes...>::Disconnect (T* obj, void (T::*method) (ParamTypes...))
 {
   DelegateToken<ParamTypes...>* conn = 0;
-  for (Token* p = last_token_; p; p = p->previous) {
-    conn = dynamic_cast<DelegateToken<ParamTypes...>*>(p);
-    if (conn && (conn->delegate().template equal<T>(obj, method)))
-      delete conn;
-  }
+  while ((conn = FindDelegateToken(obj, method)))
+    delete conn;
 }
 
 template<typename ... ParamTypes>
 void Event<ParamTypes...>::Disconnect1 (Event<ParamTypes...>& other)
 {
-  EventToken<ParamTypes...>* conn = 0;
-  for (Token* p = last_token_; p; p = p->previous) {
-    conn = dynamic_cast<EventToken<ParamTypes...>*>(p);
-    if (conn && (conn->event() == (&other))) {
-      delete conn;
-      break;
-    }
-  }
+  EventToken<ParamTypes...>* conn = FindEventToken(&other);
+  if (conn) delete conn;
 }
 
 template<typename ... ParamTypes>
 void Event<ParamTypes...>::Disconnect (Event<ParamTypes...>& other)
 {
   EventToken<ParamTypes...>* conn = 0;
-  for (Token* p = last_token_; p; p = p->previous) {
-    conn = dynamic_cast<EventToken<ParamTypes...>*>(p);
-    if (conn && (conn->event() == (&other))) delete conn;
-  }
+  while ((conn = FindEventToken(&other)))
+    delete conn;
 }
 
 template<typename ... ParamTypes>
@@ -307,8 +462,10 @@ void Event<ParamTypes...>::DisconnectFromEvents ()
 }
 
 template<typename ... ParamTypes>
-void Event<ParamTypes...>::Invoke (ParamTypes ... Args)
+void Event<ParamTypes...>::Invoke (typename ParamTraits<ParamTypes>::ParamType ... Args)
 {
+  Lock();
+
   iterator_ = first_token_;
   while (iterator_) {
     static_cast<InvokableToken<ParamTypes...>*>(iterator_)->Invoke(Args...);
@@ -322,17 +479,42 @@ void Event<ParamTypes...>::Invoke (ParamTypes ... Args)
   }
   iterator_ = 0;
   iterator_removed_ = false;
+
+  Unlock();
 }
 
 template<typename ... ParamTypes>
 void Event<ParamTypes...>::AuditDestroyingToken (Token* token)
 {
+  Lock();
+
+  token_count_--;
+
+  if (index_) {
+    std::pair<TokenIndex::iterator, TokenIndex::iterator> range =
+        index_->equal_range(token->target);
+    for (TokenIndex::iterator it = range.first; it != range.second; ++it) {
+      if (it->second == token) {
+        index_->erase(it);
+        break;
+      }
+    }
+  }
+
   if (token == first_token_) first_token_ = token->next;
   if (token == last_token_) last_token_ = token->previous;
   if (token == iterator_) {
     iterator_removed_ = true;
     iterator_ = iterator_->next;
   }
+
+  // unlink here under the lock rather than in Token::~Token()
+  if (token->previous) token->previous->next = token->next;
+  if (token->next) token->next->previous = token->previous;
+  token->previous = 0;
+  token->next = 0;
+
+  Unlock();
 }
 
 template<typename ... ParamTypes>
@@ -342,6 +524,8 @@ void Event<ParamTypes...>::PushBackToken(InvokableToken<ParamTypes...>* token)
   assert(token->trackable_object == 0);
 #endif
 
+  Lock();
+
   if (last_token_) {
     last_token_->next = token;
     token->previous = last_token_;
@@ -355,6 +539,9 @@ void Event<ParamTypes...>::PushBackToken(InvokableToken<ParamTypes...>* token)
   last_token_ = token;
   token->next = 0;
   token->trackable_object = this;
+  IndexToken(token);
+
+  Unlock();
 }
 
 template<typename ... ParamTypes>
@@ -364,6 +551,8 @@ void Event<ParamTypes...>::PushFrontToken(InvokableToken<ParamTypes...>* token)
   assert(token->trackable_object == 0);
 #endif
 
+  Lock();
+
   if (first_token_) {
     first_token_->previous = token;
     token->next = first_token_;
@@ -378,6 +567,9 @@ void Event<ParamTypes...>::PushFrontToken(InvokableToken<ParamTypes...>* token)
 
   token->previous = 0;
   token->trackable_object = this;
+  IndexToken(token);
+
+  Unlock();
 }
 
 template<typename ... ParamTypes>
@@ -387,6 +579,8 @@ void Event<ParamTypes...>::InsertToken(int index, InvokableToken<ParamTypes...>*
   assert(token->trackable_object == 0);
 #endif
 
+  Lock();
+
   if (first_token_ == 0) {
 #ifdef DEBUG
     assert(last_token_ == 0);
@@ -430,11 +624,16 @@ void Event<ParamTypes...>::InsertToken(int index, InvokableToken<ParamTypes...>*
     }
   }
   token->trackable_object = this;
+  IndexToken(token);
+
+  Unlock();
 }
 
 template<typename ... ParamTypes>
 void Event<ParamTypes...>::RemoveAllTokens()
 {
+  Lock();
+
   Token* tmp = 0;
   Token* p = first_token_;
 
@@ -443,6 +642,96 @@ void Event<ParamTypes...>::RemoveAllTokens()
     delete p;
     p = tmp;
   }
+
+  Unlock();
+}
+
+template<typename ... ParamTypes>
+template<typename T>
+DelegateToken<ParamTypes...>* Event<ParamTypes...>::FindDelegateToken (T* obj, void (T::*method) (ParamTypes...)) const
+{
+  const void* target = obj;
+  DelegateToken<ParamTypes...>* conn = 0;
+
+  if (index_) {
+    // the order of equal keys is unspecified, only a single match can
+    // be returned from the index, more are ordered by walking the list
+    DelegateToken<ParamTypes...>* found = 0;
+    int matches = 0;
+    std::pair<TokenIndex::const_iterator, TokenIndex::const_iterator> range =
+        index_->equal_range(target);
+    for (TokenIndex::const_iterator it = range.first; it != range.second; ++it) {
+      conn = dynamic_cast<DelegateToken<ParamTypes...>*>(it->second);
+      if (conn && (conn->delegate().template equal<T>(obj, method))) {
+        found = conn;
+        matches++;
+      }
+    }
+    if (matches < 2) return found;
+  }
+
+  for (Token* p = last_token_; p; p = p->previous) {
+    if (p->target != target) continue;
+    conn = dynamic_cast<DelegateToken<ParamTypes...>*>(p);
+    if (conn && (conn->delegate().template equal<T>(obj, method)))
+      return conn;
+  }
+
+  return 0;
+}
+
+template<typename ... ParamTypes>
+EventToken<ParamTypes...>* Event<ParamTypes...>::FindEventToken (const Event<ParamTypes...>* other) const
+{
+  const void* target = other;
+  EventToken<ParamTypes...>* conn = 0;
+
+  if (index_) {
+    // see FindDelegateToken()
+    EventToken<ParamTypes...>* found = 0;
+    int matches = 0;
+    std::pair<TokenIndex::const_iterator, TokenIndex::const_iterator> range =
+        index_->equal_range(target);
+    for (TokenIndex::const_iterator it = range.first; it != range.second; ++it) {
+      conn = dynamic_cast<EventToken<ParamTypes...>*>(it->second);
+      if (conn && (conn->event() == other)) {
+        found = conn;
+        matches++;
+      }
+    }
+    if (matches < 2) return found;
+  }
+
+  for (Token* p = last_token_; p; p = p->previous) {
+    if (p->target != target) continue;
+    conn = dynamic_cast<EventToken<ParamTypes...>*>(p);
+    if (conn && (conn->event() == other)) return conn;
+  }
+
+  return 0;
+}
+
+template<typename ... ParamTypes>
+void Event<ParamTypes...>::IndexToken (Token* token)
+{
+  token_count_++;
+
+  if (index_) {
+    index_->insert(std::make_pair(token->target, token));
+  } else if (token_count_ >= kIndexThreshold) {
+    BuildIndex();
+  }
+}
+
+template<typename ... ParamTypes>
+void Event<ParamTypes...>::BuildIndex ()
+{
+  index_ = new TokenIndex;
+  index_->reserve(token_count_ * 2);
+
+  for (Token* p = first_token_; p; p = p->next) {
+    index_->insert(std::make_pair(p->target, p));
+  }
 }
 
 } // namespace CppEvent
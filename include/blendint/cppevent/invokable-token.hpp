@@ -27,6 +27,7 @@
 #pragma once
 
 #include <cppevent/abstract-trackable.hpp>
+#include <cppevent/param-traits.hpp>
 
 namespace CppEvent {
 
@@ -35,17 +36,17 @@ class InvokableToken: public Token
 {
  public:
 
-  inline InvokableToken ();
+  inline InvokableToken (const void* target = 0);
 
   virtual ~InvokableToken ();
-
-  virtual void Invoke (ParamTypes ... Args);
+  virtual void Invoke (typename ParamTraits<ParamTypes>::ParamType ... Args);
 };
 
 template<typename ... ParamTypes>
-inline InvokableToken<ParamTypes...>::InvokableToken ()
+inline InvokableToken<ParamTypes...>::InvokableToken (const void* target)
     : Token()
 {
+  this->target = target;
 }
 
 template<typename ... ParamTypes>
@@ -54,7 +55,7 @@ InvokableToken<ParamTypes...>::~InvokableToken ()
 }
 
 template<typename ... ParamTypes>
-void InvokableToken<ParamTypes...>::Invoke (ParamTypes ... Args)
+void InvokableToken<ParamTypes...>::Invoke (typename ParamTraits<ParamTypes>::ParamType ... Args)
 {
   // Override this in sub class
 }
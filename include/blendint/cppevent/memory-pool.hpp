@@ -0,0 +1,84 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Freeman Zhang <zhanggyb@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+
+namespace CppEvent {
+
+/**
+ * @brief Size-class free lists for tokens and bindings
+ *
+ * Every connection allocates one Binding and one Token, both small
+ * and short-lived compared to the general heap. MemoryPool carves
+ * them out of 4 KB slabs, one free list per 16-byte size class, so
+ * Connect/Disconnect do not go through malloc and bindings of the
+ * same event tend to sit next to each other in memory.
+ *
+ * Blocks larger than kMaxBlockSize fall back to ::operator new. The
+ * pool is guarded by a spin lock since a token may be destroyed in a
+ * different thread than it was created in. Slabs are never returned
+ * to the system.
+ */
+class MemoryPool
+{
+ public:
+
+  static void* Allocate (size_t size);
+
+  static void Deallocate (void* p, size_t size);
+
+  /**
+   * @brief Number of blocks currently handed out by the pool
+   */
+  static size_t live_count ();
+
+  /**
+   * @brief Number of slabs allocated so far
+   */
+  static size_t slab_count ();
+
+  /**
+   * @brief Number of requests which were too large for the pool
+   */
+  static size_t fallback_count ();
+
+  static const size_t kGranularity = 16;
+
+  static const size_t kMaxBlockSize = 128;
+
+  static const size_t kSlabSize = 4096;
+
+ private:
+
+  MemoryPool ();
+
+  ~MemoryPool ();
+
+};
+
+}  // namespace CppEvent
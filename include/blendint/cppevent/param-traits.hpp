@@ -0,0 +1,60 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Freeman Zhang <zhanggyb@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <type_traits>
+
+namespace CppEvent {
+
+/**
+ * @brief Select how an event argument is passed along the invoke chain
+ *
+ * An argument goes through Event::Invoke, every InvokableToken, the
+ * Delegate and its method stub before it reaches the listener. Taking
+ * each hop by value copies the payload several times per listener,
+ * which shows for String or other heap-owning types.
+ *
+ * Trivially copyable types no larger than two pointers (int, float,
+ * Point, Size...) are still passed by value as they fit in registers,
+ * references are passed through unchanged, everything else is bound
+ * as a const reference so the only remaining copy is the one the
+ * listener asks for in its own signature.
+ */
+template<typename T>
+struct ParamTraits
+{
+  typedef typename std::remove_cv<T>::type ValueType;
+
+  static const bool kByValue =
+      std::is_reference<T>::value ||
+      (std::is_trivially_copyable<ValueType>::value &&
+       (sizeof(ValueType) <= 2 * sizeof(void*)));
+
+  typedef typename std::conditional<kByValue, T, const ValueType&>::type ParamType;
+};
+
+}  // namespace CppEvent
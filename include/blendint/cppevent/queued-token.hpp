@@ -0,0 +1,147 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Freeman Zhang <zhanggyb@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+
+#include <cppevent/delegate-token.hpp>
+#include <cppevent/dispatcher.hpp>
+
+namespace CppEvent {
+
+/**
+ * @brief A delegate token which calls its method in another thread
+ *
+ * Invoke() copies the arguments into a task and posts it to the
+ * dispatcher instead of calling the delegate, so the producer never
+ * waits for the receiver. As a DelegateToken it is found and removed
+ * by Event::Disconnect() like a direct connection.
+ *
+ * Invoke() runs in the producer thread under the lock of the event,
+ * the destructor detaches from the event under the same lock first,
+ * so the token is never torn down while a producer uses it.
+ */
+template<typename ... ParamTypes>
+class QueuedToken : public DelegateToken < ParamTypes... >
+{
+ public:
+
+  QueuedToken() = delete;
+
+  inline QueuedToken(const Delegate<void, ParamTypes...>& d,
+                     AbstractDispatcher* dispatcher,
+                     ConnectionMode mode);
+
+  virtual ~QueuedToken();
+
+  virtual void Invoke(typename ParamTraits<ParamTypes>::ParamType... Args) override;
+
+ private:
+
+  AbstractDispatcher* dispatcher_;
+
+  ConnectionMode mode_;
+
+  std::shared_ptr<QueuedState> state_;
+
+};
+
+template<typename ... ParamTypes>
+inline QueuedToken<ParamTypes...>::QueuedToken(const Delegate<void, ParamTypes...>& d,
+                                               AbstractDispatcher* dispatcher,
+                                               ConnectionMode mode)
+    : DelegateToken<ParamTypes...>(d),
+      dispatcher_(dispatcher),
+      mode_(mode),
+      state_(std::make_shared<QueuedState>())
+{
+}
+
+template<typename ... ParamTypes>
+QueuedToken<ParamTypes...>::~QueuedToken()
+{
+  // waits for a producer in Invoke(), none can reach us afterwards
+  this->Detach();
+  state_->connected = false;
+}
+
+template<typename ... ParamTypes>
+void QueuedToken<ParamTypes...>::Invoke(typename ParamTraits<ParamTypes>::ParamType... Args)
+{
+  // bind() stores decayed copies, references never cross the thread
+  std::function<void()> call =
+      std::bind(&Delegate<void, ParamTypes...>::invoke, this->delegate(), Args...);
+
+  std::shared_ptr<QueuedState> state = state_;
+  AbstractDispatcher* dispatcher = dispatcher_;
+
+  if (mode_ == CoalescedConnection) {
+
+    state->Lock();
+    bool pending = state->pending;
+    state->latest.swap(call);
+    state->pending = true;
+    state->Unlock();
+
+    if (pending) {
+      dispatcher->count_coalesced();
+      return;
+    }
+
+    bool posted = dispatcher->Dispatch([state, dispatcher] () {
+        std::function<void()> latest;
+        state->Lock();
+        latest.swap(state->latest);
+        state->pending = false;
+        state->Unlock();
+
+        if (state->connected && latest)
+          latest();
+        else
+          dispatcher->count_dropped();
+      });
+
+    if (!posted) {
+      state->Lock();
+      state->latest = nullptr;
+      state->pending = false;
+      state->Unlock();
+    }
+
+  } else {
+
+    dispatcher->Dispatch([state, dispatcher, call] () {
+        if (state->connected)
+          call();
+        else
+          dispatcher->count_dropped();
+      });
+
+  }
+}
+
+} // namespace CppEvent
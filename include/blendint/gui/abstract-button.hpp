@@ -132,6 +132,7 @@ class AbstractButton: public AbstractRoundWidget
   inline void set_icon (const RefPtr<AbstractIcon>& icon)
   {
     icon_ = icon;
+    InvalidateSizeHint();
   }
 
   inline void set_text (const String& text)
@@ -141,11 +142,13 @@ class AbstractButton: public AbstractRoundWidget
     } else {
       text_.reset(new Text(text));
     }
+    InvalidateSizeHint();
   }
 
   inline void set_font (const Font& font)
   {
     if (text_) text_->SetFont(font);
+    InvalidateSizeHint();
   }
 
   void DrawIconText ();
@@ -208,6 +211,7 @@ class AbstractButton: public AbstractRoundWidget
   inline void set_text (const RefPtr<Text>& text)
   {
     text_ = text;
+    InvalidateSizeHint();
   }
 
   static Margin kPadding;
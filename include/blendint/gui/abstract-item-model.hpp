@@ -23,7 +23,10 @@
 
 #pragma once
 
+#include <vector>
+
 #include <blendint/core/object.hpp>
+#include <blendint/core/object-pool.hpp>
 #include <blendint/core/string.hpp>
 
 #include <blendint/gui/font.hpp>
@@ -55,7 +58,11 @@ struct ModelNode
   ModelNode* left;
   ModelNode* right;
 
+  // a form to draw, when set it is used instead of string
   RefPtr<AbstractForm> data;
+
+  // the raw value, views turn it into glyphs only when visible
+  String string;
 };
 
 class ModelIndex
@@ -84,8 +91,17 @@ class ModelIndex
 
   RefPtr<AbstractForm> GetData () const;
 
+  /**
+   * @brief Borrow the data without the reference count round trip of
+   * GetData(), preferred when drawing cells
+   */
   const AbstractForm* GetRawData () const;
 
+  /**
+   * @brief The raw string of this index, empty if invalid
+   */
+  const String& GetString () const;
+
   ModelIndex GetRootIndex () const;
 
   ModelIndex GetParentIndex () const;
@@ -130,6 +146,71 @@ inline bool operator == (const ModelIndex& src, const ModelIndex& dst)
   return src.node_ == dst.node_;
 }
 
+/**
+ * @brief Row-indexed, column-major table of the top level cells
+ *
+ * The nodes of the rows under one parent are recorded column by
+ * column in a single vector (column * rows + row), so a model can
+ * answer GetIndex(row, column) in O(1) and scan a column through
+ * contiguous memory instead of walking the down/right links.
+ *
+ * The links stay the source of truth: a model calls Invalidate()
+ * after every structural change and the table is rebuilt on the next
+ * lookup. Cells missing in a short row are null.
+ */
+class ModelTable
+{
+ public:
+
+  inline ModelTable ()
+      : rows_(0), columns_(0), valid_(false)
+  {
+  }
+
+  inline void Invalidate ()
+  {
+    valid_ = false;
+  }
+
+  /**
+   * @brief Record the rows under parent
+   */
+  void Rebuild (const ModelNode* parent);
+
+  inline ModelNode* cell (int row, int column) const
+  {
+    if ((row < 0) || (row >= rows_) || (column < 0) || (column >= columns_))
+      return 0;
+
+    return cells_[column * rows_ + row];
+  }
+
+  inline bool valid () const
+  {
+    return valid_;
+  }
+
+  inline int rows () const
+  {
+    return rows_;
+  }
+
+  inline int columns () const
+  {
+    return columns_;
+  }
+
+ private:
+
+  std::vector<ModelNode*> cells_;
+
+  int rows_;
+
+  int columns_;
+
+  bool valid_;
+};
+
 /**
  * @brief The abstract interface for item model classes.
  *
@@ -206,14 +287,46 @@ class AbstractItemModel: public Object
   virtual bool SetData (const ModelIndex& index,
                         const RefPtr<AbstractForm>& data);
 
+  /**
+   * @brief Set the raw string of a cell
+   *
+   * Cheaper than SetData() with a Text: no GL object is created until
+   * a view draws the cell.
+   */
+  virtual bool SetString (const ModelIndex& index, const String& string);
+
   /**
    * @brief Get the font used to show string in this model
    */
   virtual BlendInt::Font GetFont (const ModelIndex& parent =
                                   ModelIndex()) const;
 
+  /**
+   * @brief The arena holding the nodes of this model
+   */
+  inline const FixedPool& node_pool () const
+  {
+    return nodes_.pool();
+  }
+
  protected:
 
+  /**
+   * @brief Create a node in the arena of this model
+   *
+   * Nodes must be destroyed with DestroyNode() of the same model, the
+   * arena returns its memory in bulk when the model is deleted.
+   */
+  inline ModelNode* CreateNode ()
+  {
+    return nodes_.Construct();
+  }
+
+  inline void DestroyNode (ModelNode* node)
+  {
+    nodes_.Destroy(node);
+  }
+
   static inline bool set_index_data (const ModelIndex& index,
                                      const RefPtr<AbstractForm>& data)
   {
@@ -225,6 +338,17 @@ class AbstractItemModel: public Object
     }
   }
 
+  static inline bool set_index_string (const ModelIndex& index,
+                                       const String& string)
+  {
+    if (index.node_) {
+      index.node_->string = string;
+      return true;
+    } else {
+      return false;
+    }
+  }
+
   static inline void set_index_node (ModelIndex& index, ModelNode* node)
   {
     index.node_ = node;
@@ -235,6 +359,10 @@ class AbstractItemModel: public Object
     return index.node_;
   }
 
+ private:
+
+  ObjectPool<ModelNode> nodes_;
+
 };
 
 }
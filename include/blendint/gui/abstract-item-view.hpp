@@ -57,6 +57,16 @@ class AbstractItemView: public AbstractScrollable
 
   virtual ModelIndex GetIndexAt (const Point& point) const = 0;
 
+  /**
+   * @brief Scroll the rows vertically
+   * @param[in] y Distance in pixels from the top of the first row
+   * to the top edge of this view, clamped to the rows of the model
+   *
+   * The scroll position is kept in the offset of AbstractScrollable,
+   * and the scrolled event is fired when it changes.
+   */
+  void ScrollTo (int y);
+
   CppEvent::EventRef<> model_changed ()
   {
     return model_changed_;
@@ -64,6 +74,30 @@ class AbstractItemView: public AbstractScrollable
 
  protected:
 
+  /**
+   * @brief The uniform height of each row
+   *
+   * Sub classes drawing rows of the same height override this to
+   * enable GetVisibleRows() and GetRowAt().
+   */
+  virtual int GetRowHeight () const;
+
+  /**
+   * @brief Get the rows intersecting this view at the current scroll
+   * position
+   * @param[out] first The first visible row
+   * @param[out] y The bottom of the first visible row in local
+   * coordinates
+   * @return The number of visible rows, 0 if none
+   */
+  int GetVisibleRows (int* first, int* y) const;
+
+  /**
+   * @brief Get the row at a local y position
+   * @return The row number, or -1 if no row is there
+   */
+  int GetRowAt (int y) const;
+
   void set_model (const RefPtr<AbstractItemModel>& model)
   {
     model_ = model;
@@ -48,6 +48,20 @@ public:
 
   virtual void Adjust () = 0;
 
+  /**
+   * @brief Mark this layout dirty and schedule a layout pass
+   *
+   * The sub widgets are not adjusted immediately, Adjust() is called
+   * once in the next PreDraw() or in FlushLayout(), no matter how
+   * many times this function is called before.
+   */
+  void RequestLayout ();
+
+  /**
+   * @brief Run the pending layout pass now if this layout is dirty
+   */
+  void FlushLayout ();
+
   const Margin& margin () const
   {
     return margin_;
@@ -55,8 +69,15 @@ public:
 
   void SetMargin (const Margin& margin);
 
+  inline bool layout_dirty () const
+  {
+    return layout_dirty_;
+  }
+
 protected:
 
+  virtual bool PreDraw (AbstractWindow* context);
+
   virtual Response Draw (AbstractWindow* context);
 
   virtual void PerformMarginUpdate (const Margin& margin);
@@ -70,6 +91,8 @@ private:
 
   Margin margin_;
 
+  bool layout_dirty_;
+
 };
 
 }
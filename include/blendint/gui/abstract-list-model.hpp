@@ -105,9 +105,9 @@ protected:
 
 private:
 
-  static void DestroyChildNode (ModelNode* node);
+  void DestroyChildNode (ModelNode* node);
 
-  static void DestroyRow (ModelNode * node);
+  void DestroyRow (ModelNode * node);
 
   /**
    * @brief Clear and delete all child node from m_root->child
@@ -116,6 +116,8 @@ private:
 
   ModelNode* root_;
 
+  mutable ModelTable table_;
+
 };
 
 }
@@ -40,7 +40,10 @@ namespace BlendInt {
 
 class AbstractWindow;
 class AbstractFrame;
+class AbstractWidget;
+class AbstractNode;
 class ManagedPtr;
+class HitTestGrid;
 struct ColorScheme;
 
 enum ViewType
@@ -132,6 +135,13 @@ public:
 
   void MoveTo (const Point& pos);
 
+  /**
+   * @brief Mark this view and its super views to be drawn in the next
+   * frame
+   *
+   * Must be called in the main thread, other threads post a task with
+   * AbstractWindow::PostToUIThread().
+   */
   void RequestRedraw ();
 
   virtual bool IsExpandX () const;
@@ -140,6 +150,33 @@ public:
 
   virtual Size GetPreferredSize () const;
 
+  /**
+   * @brief Get the preferred size from the size hint cache
+   *
+   * GetPreferredSize() is only called again after the cache is
+   * dropped by InvalidateSizeHint(). Layouts should use this
+   * instead of GetPreferredSize() when scanning sub views.
+   */
+  const Size& GetCachedPreferredSize () const;
+
+  /**
+   * @brief Get IsExpandX() from the size hint cache
+   */
+  bool IsCachedExpandX () const;
+
+  /**
+   * @brief Get IsExpandY() from the size hint cache
+   */
+  bool IsCachedExpandY () const;
+
+  /**
+   * @brief Drop the cached size hint of this view and all superviews
+   *
+   * Call this when something changes the preferred size or the
+   * expand flags, e.g. text, font, margin or sub views.
+   */
+  void InvalidateSizeHint ();
+
   virtual bool Contain (const Point& point) const;
 
   // always return (0, 0) except AbstractScrollable
@@ -160,6 +197,18 @@ public:
    */
   virtual bool IsSubViewActive (const AbstractView* subview) const;
 
+  /**
+   * @brief Find the top most sub widget which contains the point
+   * @param[in] point The position in the coordinates of this view
+   *
+   * Sub views are tested from the last one and the search stops at
+   * the first one which is not a widget. Views with at least
+   * kHitTestGridThreshold sub views use a HitTestGrid which is rebuilt
+   * only after one of its own sub views moved, resized, or the sub
+   * view list changed.
+   */
+  AbstractView* FindSubWidgetAt (const Point& point) const;
+
   virtual bool SizeUpdateTest (const AbstractView* source,
                                const AbstractView* target,
                                int width,
@@ -232,6 +281,42 @@ public:
 
   static void SetDefaultBorderWidth (float border);
 
+  /**
+   * @brief Keep the size hint recompute count of the last frame and
+   * start counting again
+   *
+   * Called once per frame by the window before drawing.
+   */
+  static void ResetSizeHintStats ();
+
+  /**
+   * @brief The number of size hints recomputed in the last frame
+   */
+  static inline unsigned int size_hint_recompute_count ()
+  {
+    return kLastSizeHintRecomputeCount;
+  }
+
+  /**
+   * @brief The number of intermediate resizes dropped so far
+   *
+   * Window resizes and splitter drags are recorded and applied once
+   * per frame with the latest value only, this counts the values
+   * which were overwritten before being applied.
+   */
+  static inline unsigned int skipped_resize_count ()
+  {
+    return kSkippedResizeCount;
+  }
+
+  /**
+   * @brief The number of Draw() calls of views so far
+   */
+  static inline unsigned int draw_count ()
+  {
+    return kDrawCount;
+  }
+
   static inline bool is_window (const AbstractView* view)
   {
     return view ? view->view_type_ == ViewTypeWindow : false;
@@ -257,6 +342,28 @@ public:
     return view ? view->view_type_ == ViewTypeUndefined : false;
   }
 
+  /**
+   * @brief Cast a view to AbstractFrame through the view type tag
+   * @return 0 if the view is not a frame
+   *
+   * A cheap replacement of dynamic_cast in event dispatching, debug
+   * builds verify the result with dynamic_cast. The tag only tells the
+   * base type, use dynamic_cast for concrete frame types.
+   */
+  static AbstractFrame* frame_cast (AbstractView* view);
+
+  /**
+   * @brief Cast a view to AbstractWidget through the view type tag
+   * @return 0 if the view is not a widget
+   */
+  static AbstractWidget* widget_cast (AbstractView* view);
+
+  /**
+   * @brief Cast a view to AbstractNode through the view type tag
+   * @return 0 if the view is not a node
+   */
+  static AbstractNode* node_cast (AbstractView* view);
+
   static inline float default_border_width ()
   {
     return kBorderWidth;
@@ -294,6 +401,7 @@ protected:
   void set_position (int x, int y)
   {
     position_.reset(x, y);
+    notify_super_geometry();
   }
 
   /**
@@ -306,6 +414,7 @@ protected:
   void set_position (const Point& pos)
   {
     position_ = pos;
+    notify_super_geometry();
   }
 
   /**
@@ -319,6 +428,7 @@ protected:
   inline void set_size (int width, int height)
   {
     size_.reset(width, height);
+    notify_super_geometry();
   }
 
   /**
@@ -331,6 +441,7 @@ protected:
   inline void set_size (const Size& size)
   {
     size_ = size;
+    notify_super_geometry();
   }
 
   inline AbstractView* first () const
@@ -416,8 +527,21 @@ protected:
                                       int x,
                                       int y);
 
+  /**
+   * @brief Get the sub view at the given index
+   *
+   * Uses the contiguous sub view index, which is built on the first
+   * indexed access after the sub views change, so repeated calls are
+   * O(1).
+   */
   AbstractView* GetSubViewAt (int i) const;
 
+  /**
+   * @brief Get the index of a sub view
+   * @return The index, or -1 if view is not a sub view of this one
+   */
+  int GetSubViewIndex (const AbstractView* view) const;
+
   AbstractView* PushFrontSubView (AbstractView* view);
 
   AbstractView* InsertSubView (int index, AbstractView* view);
@@ -440,6 +564,19 @@ protected:
 
   void MoveSubViewTo (AbstractView* sub, const Point& pos);
 
+  /**
+   * @brief Set if the preferred size is computed from the geometry of
+   * sub views
+   *
+   * If true, moving or resizing a sub view drops the cached size hint
+   * of this view. Only for views which place sub views without a
+   * layout, a layout already invalidates through its own setters.
+   */
+  inline void set_size_hint_follows_subviews (bool follows)
+  {
+    size_hint_follows_subviews_ = follows;
+  }
+
   Response RecursiveDispatchKeyEvent (AbstractView* view,
                                       AbstractWindow* context);
 
@@ -540,6 +677,16 @@ protected:
     return kEmbossVertexTable[round_type & 0x0F];
   }
 
+  static inline void count_skipped_resize ()
+  {
+    kSkippedResizeCount++;
+  }
+
+  static inline void count_draw ()
+  {
+    kDrawCount++;
+  }
+
   static inline AbstractView* previous (const AbstractView* view)
   {
     return view->previous_;
@@ -598,6 +745,25 @@ private:
     destroying_ = destroying;
   }
 
+  /**
+   * @brief Rebuild subview_index_ from the sub view list
+   */
+  void BuildSubViewIndex () const;
+
+  inline void notify_super_geometry ()
+  {
+    if (super_) {
+      super_->geometry_stamp_++;
+      if (super_->size_hint_follows_subviews_) super_->InvalidateSizeHint();
+    }
+  }
+
+  inline void invalidate_subview_index ()
+  {
+    subview_index_valid_ = false;
+    geometry_stamp_++;
+  }
+
   std::atomic_bool refresh_;
 
   bool destroying_;
@@ -625,6 +791,31 @@ private:
 
   Size size_;
 
+  mutable Size cached_preferred_size_;
+
+  mutable int size_hint_flags_;
+
+  /**
+   * @brief Contiguous copy of the sub view list for indexed access
+   *
+   * Kept in sync on push back and pop back, rebuilt lazily after other
+   * changes. Sibling iteration still uses the intrusive list.
+   */
+  mutable std::vector<AbstractView*> subview_index_;
+
+  mutable bool subview_index_valid_;
+
+  // the position in super_->subview_index_
+  mutable int index_in_super_;
+
+  mutable HitTestGrid* hit_test_grid_;
+
+  // increased whenever a sub view moves or resizes, or the sub view
+  // list changes, compared with the stamp of hit_test_grid_
+  unsigned int geometry_stamp_;
+
+  bool size_hint_follows_subviews_;
+
 #ifdef DEBUG
   std::string name_;
 #endif
@@ -633,6 +824,16 @@ private:
 
   static float kBorderWidth;
 
+  static unsigned int kSizeHintRecomputeCount;
+
+  static unsigned int kLastSizeHintRecomputeCount;
+
+  static unsigned int kSkippedResizeCount;
+
+  static unsigned int kDrawCount;
+
+  static const int kHitTestGridThreshold = 32;
+
   static const float cornervec[WIDGET_CURVE_RESOLU][2];
 
   static const int kOutlineVertexTable[16];
@@ -23,8 +23,18 @@
 
 #pragma once
 
+#include <deque>
+#include <atomic>
+#include <chrono>
+#include <functional>
+
 #include <blendint/core/input.hpp>
+#include <blendint/core/mpsc-queue.hpp>
+#include <blendint/core/string.hpp>
 #include <blendint/gui/abstract-view.hpp>
+#include <blendint/gui/input-event.hpp>
+#include <blendint/gui/input-record.hpp>
+#include <blendint/gui/frame-scheduler.hpp>
 
 #include <blendint/stock/icons.hpp>
 #include <blendint/stock/theme.hpp>
@@ -171,6 +181,20 @@ public:
 
   virtual const Point& GetGlobalCursorPosition () const = 0;
 
+  /**
+   * @brief Append an input event to the queue of this window
+   *
+   * The window system backend posts every event here, and they are
+   * dispatched in order by ProcessInputEvents() once per frame. Must be
+   * called in the main thread.
+   */
+  void PostInputEvent (const InputEvent& event);
+
+  inline bool has_input_events () const
+  {
+    return !input_queue_.empty();
+  }
+
   Point GetAbsolutePosition (const AbstractView* widget);
 
   Point GetRelativePosition (const AbstractView* widget);
@@ -195,6 +219,33 @@ public:
     return mouse_tracking_;
   }
 
+  /**
+   * @brief Keep every cursor position between two dispatched mouse moves
+   *
+   * Mouse moves are merged and dispatched at most once per frame with
+   * the latest position. A widget which needs the intermediate
+   * positions too (e.g. to capture a stroke) enables sampling and reads
+   * cursor_samples() in PerformMouseMove().
+   */
+  inline void set_cursor_sampling (bool sampling)
+  {
+    cursor_sampling_ = sampling;
+    if (!sampling) cursor_samples_.clear();
+  }
+
+  inline bool cursor_sampling () const
+  {
+    return cursor_sampling_;
+  }
+
+  /**
+   * @brief The cursor positions merged into the current mouse move, oldest first
+   */
+  inline const std::vector<Point>& cursor_samples () const
+  {
+    return cursor_samples_;
+  }
+
   inline void set_local_cursor_position (const Point& point)
   {
     local_cursor_position_ = point;
@@ -257,7 +308,7 @@ public:
 
   static inline AbstractWindow* main_window ()
   {
-    return kMainWindow;
+    return kMainWindow.load();
   }
 
   static inline Theme* theme ()
@@ -275,6 +326,105 @@ public:
     return kShaders;
   }
 
+  /**
+   * @brief The scheduler pacing the frames of all windows
+   */
+  static inline FrameScheduler* frame_scheduler ()
+  {
+    return &kFrameScheduler;
+  }
+
+  /**
+   * @brief Time in milliseconds from the oldest input event handled in
+   * the last presented frame to the buffer swap of that frame
+   */
+  inline double input_latency () const
+  {
+    return input_latency_;
+  }
+
+  /**
+   * @brief Write the dispatched input events to a recorder
+   * @param[in] recorder An open recorder, or 0 to stop recording. Not
+   * owned by this window.
+   */
+  inline void set_input_recorder (InputRecorder* recorder)
+  {
+    input_recorder_ = recorder;
+  }
+
+  /**
+   * @brief Replace the live input with a recording
+   * @param[in] replayer A loaded replayer, or 0 to stop replaying. Not
+   * owned by this window.
+   */
+  inline void set_input_replayer (InputReplayer* replayer)
+  {
+    input_replayer_ = replayer;
+  }
+
+  inline InputReplayer* input_replayer () const
+  {
+    return input_replayer_;
+  }
+
+  /**
+   * @brief If events are replayed instead of the live input
+   */
+  bool replaying () const;
+
+  /**
+   * @brief The number of mouse moves merged into a later one so far
+   */
+  static inline unsigned int merged_mouse_move_count ()
+  {
+    return kMergedMouseMoveCount;
+  }
+
+  /**
+   * @brief Run a task in the main thread before the next frame
+   *
+   * Can be called in any thread without blocking, this is the way for
+   * other threads to touch views or GL state of the main context. The
+   * task must not use objects which may be destroyed before it runs.
+   */
+  static void PostToUIThread (const std::function<void()>& task);
+
+  /**
+   * @brief Run a task in the main thread and wait until it's done
+   *
+   * The task runs right away if called in the main thread. Must not be
+   * called after the event loop quits.
+   */
+  static void InvokeOnUIThread (const std::function<void()>& task);
+
+  /**
+   * @brief The dispatcher of the main thread for queued connections
+   *
+   * Use it to connect an event invoked in another thread to a view:
+   * event.Connect(view, &View::OnFoo, AbstractWindow::ui_dispatcher(),
+   * CppEvent::CoalescedConnection). Calls go through PostToUIThread()
+   * and are dropped while too many tasks are waiting.
+   */
+  static CppEvent::AbstractDispatcher* ui_dispatcher ();
+
+  /**
+   * @brief The number of posted tasks which have not run yet
+   */
+  static inline int ui_task_depth ()
+  {
+    return kUITaskDepth.load();
+  }
+
+  /**
+   * @brief The longest time in milliseconds a task waited in the queue,
+   * in the last frame with tasks
+   */
+  static inline double ui_task_latency ()
+  {
+    return kUITaskLatency;
+  }
+
 protected:
 
   virtual bool PreDraw (AbstractWindow* context);
@@ -307,6 +457,43 @@ protected:
 
   void DispatchMouseHover ();
 
+  /**
+   * @brief Dispatch all queued input events
+   *
+   * Consecutive cursor moves are merged into the last one, and only the
+   * last resize of the queue is applied.
+   */
+  void ProcessInputEvents ();
+
+  /**
+   * @brief Run the tasks posted by PostToUIThread()
+   *
+   * Tasks posted by the running tasks are left for the next call.
+   */
+  static void ProcessUITasks ();
+
+  /**
+   * @brief Update input_latency() and replay statistics after a frame
+   * @param[in] presented If the frame was drawn and swapped
+   */
+  void FinishInputFrame (bool presented);
+
+  /**
+   * @brief The state built from the input events processed so far
+   *
+   * Key, mouse and cursor fields keep the values of the latest event of
+   * their type, the backend returns them in GetKeyInput() etc.
+   */
+  inline const InputEvent& current_input () const
+  {
+    return current_input_;
+  }
+
+  inline const String& current_text () const
+  {
+    return current_text_;
+  }
+
   inline void set_viewport_origin (int x, int y)
   {
     viewport_origin_.reset(x, y);
@@ -327,6 +514,16 @@ protected:
     stencil_count_ = count;
   }
 
+  inline void push_cursor_sample (const Point& point)
+  {
+    if (cursor_sampling_) cursor_samples_.push_back(point);
+  }
+
+  inline void clear_cursor_samples ()
+  {
+    cursor_samples_.clear();
+  }
+
   static glm::mat4 default_view_matrix;
 
   static std::thread::id kMainThreadID;
@@ -355,8 +552,18 @@ protected:
 
   static Icons* kIcons;
 
+  static FrameScheduler kFrameScheduler;
+
+  /**
+   * @brief Wakes up the event loop, set by the window system while it
+   * is initialized, can be called in any thread
+   */
+  static std::atomic<void (*) ()> kWakeupHandler;
+
   static Shaders* kShaders;
 
+  static unsigned int kMergedMouseMoveCount;
+
 private:
 
   friend class AbstractFrame;
@@ -403,12 +610,47 @@ private:
 
   bool mouse_tracking_;
 
+  bool cursor_sampling_;
+
+  std::vector<Point> cursor_samples_;
+
   /**
    * @brief If a frame contains the cursor
    */
   bool overlap_;
 
-  static AbstractWindow* kMainWindow;
+  std::deque<InputEvent> input_queue_;
+
+  InputEvent current_input_;
+
+  String current_text_;
+
+  // timestamp of the oldest event handled since the last frame
+  InputEvent::Clock::time_point oldest_input_;
+
+  bool input_handled_;
+
+  double input_latency_;
+
+  InputRecorder* input_recorder_;
+
+  InputReplayer* input_replayer_;
+
+  struct UITask
+  {
+    std::function<void()> task;
+
+    std::chrono::steady_clock::time_point posted;
+  };
+
+  static MPSCQueue<UITask> kUITasks;
+
+  static std::atomic<int> kUITaskDepth;
+
+  static double kUITaskLatency;
+
+  // read by PostToUIThread() in other threads
+  static std::atomic<AbstractWindow*> kMainWindow;
 };
 
 inline int pixel_size (int a)
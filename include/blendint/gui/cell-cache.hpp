@@ -0,0 +1,136 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <vector>
+#include <unordered_map>
+
+#include <blendint/core/refptr.hpp>
+#include <blendint/core/string.hpp>
+
+#include <blendint/gui/font.hpp>
+#include <blendint/gui/text.hpp>
+
+namespace BlendInt {
+
+  /**
+   * @brief Recycled Text objects for the visible cells of a view
+   *
+   * Models keep raw strings, a view asks the cache for a Text of the
+   * cell it is about to draw. A cell drawn in the previous frame gets
+   * the same Text back, a new cell takes over the Text of a cell not
+   * drawn in the last frame and only re-generates its glyphs, so the
+   * number of Text objects (and their VAO/VBO) follows the number of
+   * visible cells instead of the size of the model.
+   *
+   * Call BeginFrame() at the beginning of every Draw().
+   */
+  class CellCache
+  {
+  public:
+
+    explicit CellCache (size_t capacity = 128);
+
+    ~CellCache ();
+
+    /**
+     * @brief Start a new frame, cells not requested since are recycled
+     */
+    inline void BeginFrame ()
+    {
+      stamp_++;
+    }
+
+    /**
+     * @brief Get a Text showing value for the cell at row and column
+     */
+    const Text* Get (int row, int column, const String& value);
+
+    /**
+     * @brief Set the font of all cells, drops them if it changes
+     */
+    void SetFont (const Font& font);
+
+    void Clear ();
+
+    inline size_t size () const
+    {
+      return entries_.size();
+    }
+
+    inline size_t hit_count () const
+    {
+      return hit_count_;
+    }
+
+    inline size_t miss_count () const
+    {
+      return miss_count_;
+    }
+
+    /**
+     * @brief Number of misses served by re-using the Text of another cell
+     */
+    inline size_t recycle_count () const
+    {
+      return recycle_count_;
+    }
+
+  private:
+
+    struct Entry
+    {
+      RefPtr<Text> text;
+      uint64_t key;
+      unsigned int stamp;
+    };
+
+    static inline uint64_t make_key (int row, int column)
+    {
+      return (((uint64_t) (uint32_t) row) << 32) | (uint32_t) column;
+    }
+
+    std::vector<Entry> entries_;
+
+    std::unordered_map<uint64_t, size_t> lookup_;
+
+    Font font_;
+
+    size_t capacity_;
+
+    size_t victim_;
+
+    unsigned int stamp_;
+
+    size_t hit_count_;
+
+    size_t miss_count_;
+
+    size_t recycle_count_;
+
+    DISALLOW_COPY_AND_ASSIGN(CellCache);
+  };
+
+}
@@ -82,8 +82,18 @@ public:
     return max_text_size_;
   }
 
+  /**
+   * @brief Fired when rows, columns, icons or texts change
+   */
+  CppEvent::EventRef<> changed ()
+  {
+    return changed_;
+  }
+
 private:
 
+  CppEvent::Event<> changed_;
+
   int rows_;
 
   int columns_;
@@ -131,11 +141,10 @@ protected:
 
 private:
 
-  // 0 for inner buffer
-  // 1 for row_ background
-  GLuint vao_[2];
+  // for inner buffer
+  GLuint vao_;
 
-  GLBuffer<ARRAY_BUFFER, 2> vbo_;
+  GLBuffer<ARRAY_BUFFER, 1> vbo_;
 
   RefPtr<AbstractItemModel> model_;
 
@@ -197,6 +206,8 @@ private:
 
   void OnPopupListDestroyed (AbstractFrame* frame);
 
+  void OnModelChanged ();
+
   GLuint vaos_[2];
 
   GLBuffer<ARRAY_BUFFER, 2> vbo_;
@@ -26,13 +26,13 @@
 // generate makefile with cmake -DENABLE_OPENCV to activate
 #ifdef __USE_OPENCV__
 
-#include <mutex>
+#include <atomic>
+#include <memory>
+#include <thread>
 
 #include <opencv2/core/core.hpp>
 #include <opencv2/highgui/highgui.hpp>
 
-#include <blendint/core/timer.hpp>
-
 #include <blendint/opengl/gl-buffer.hpp>
 
 #include <blendint/gui/abstract-scrollable.hpp>
@@ -88,6 +88,13 @@ public:
 
 protected:
 
+  /**
+   * @brief Process a video frame before it's displayed
+   *
+   * Called in the main thread right before the frame is uploaded, the
+   * capture thread only reads frames. So an override never runs while
+   * its sub class is being destroyed.
+   */
   virtual void ProcessImage (cv::Mat& image);
 
   void DrawTexture ();
@@ -141,7 +148,21 @@ private:
 
   virtual void PostDraw (AbstractWindow* context);
 
-  void OnUpdateFrame ();
+  void StartCapture ();
+
+  void StopCapture ();
+
+  /**
+   * @brief Read video frames in the capture thread
+   */
+  void CaptureFrames ();
+
+  /**
+   * @brief Display a captured frame, in the main thread
+   */
+  void OnUpdateFrame (const cv::Mat& image);
+
+  void UploadTexture (const cv::Mat& image);
 
   /**
    * @brief Vertex Array Objects
@@ -160,11 +181,18 @@ private:
 
   cv::Mat image_;
 
-  RefPtr<Timer> timer_;
+  std::thread capture_thread_;
 
-  std::mutex mutex_;
+  std::atomic<bool> capturing_;
 
-  AbstractWindow* off_screen_context_;
+  // frames posted to the main thread but not displayed yet
+  std::atomic<int> pending_frames_;
+
+  // the capture interval in milliseconds
+  unsigned int interval_;
+
+  // posted frames are dropped once this is reset in the destructor
+  std::shared_ptr<CVImageView*> alive_;
 
   Size image_size_;
 
@@ -180,6 +208,8 @@ private:
    *    5 - if video is stop
    */
   int flags_;
+
+  static const int kMaxPendingFrames = 2;
 };
 
 }
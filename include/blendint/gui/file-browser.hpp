@@ -29,6 +29,8 @@
 #include <blendint/opengl/gl-buffer.hpp>
 
 #include <blendint/gui/font.hpp>
+#include <blendint/gui/cell-cache.hpp>
+#include <blendint/gui/row-stripes.hpp>
 #include <blendint/gui/abstract-item-view.hpp>
 #include <blendint/gui/filesystem-model.hpp>
 
@@ -103,6 +105,8 @@ public:
 
 protected:
 
+  virtual int GetRowHeight () const;
+
   virtual Response Draw (AbstractWindow* context);
 
   virtual void PerformSizeUpdate (const AbstractView* source,
@@ -116,15 +120,14 @@ private:
 
   void InitializeFileBrowserOnce ();
 
-  GLuint vaos_[2];
+  GLuint vao_;
 
   Font font_;
 
-  /**
-   * 0 - for inner
-   * 1 - for row
-   */
-  GLBuffer<ARRAY_BUFFER, 2> buffer_;
+  // for inner
+  GLBuffer<ARRAY_BUFFER, 1> buffer_;
+
+  RowStripes stripes_;
 
   String file_selected_;
 
@@ -136,6 +139,8 @@ private:
 
   RefPtr<FileSystemModel> model_;
 
+  CellCache cells_;
+
   int highlight_index_;
 
   CppEvent::Event<> selected_;
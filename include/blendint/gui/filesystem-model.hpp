@@ -108,9 +108,9 @@ private:
 
   void DestroyColumnsInRow (int column, int count, ModelNode* node);
 
-  static void DestroyRow (ModelNode* node);
+  void DestroyRow (ModelNode* node);
 
-  static void DestroyColumn (ModelNode* node);
+  void DestroyColumn (ModelNode* node);
 
   int rows_;
 
@@ -118,6 +118,8 @@ private:
 
   ModelNode* root_;
 
+  mutable ModelTable table_;
+
   static const int DefaultColumns = 5;
 
 };
@@ -0,0 +1,238 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include <blendint/core/types.hpp>
+#include <blendint/cppevent/event.hpp>
+
+namespace BlendInt {
+
+  /**
+   * @brief Time spent in the phases of one frame, in milliseconds
+   */
+  struct FrameTiming
+  {
+    FrameTiming ()
+    : build(0.0), swap(0.0), idle(0.0)
+    {
+    }
+
+    // from the start of the frame to the first buffer swap
+    double build;
+
+    // blocked in buffer swaps, includes waiting for vsync
+    double swap;
+
+    // waiting for events before the frame
+    double idle;
+  };
+
+  /**
+   * @brief Paces the frames of the event loop in Window::Exec()
+   *
+   * Requests from any thread are coalesced into one pending wakeup, so
+   * only the first request after the loop went idle wakes it up. A
+   * frame is only started when a window needs a redraw or an animation
+   * asked for one, and no sooner than one refresh interval after the
+   * previous frame; with vsync enabled the buffer swap already blocks
+   * for the display and frames start right away.
+   *
+   * The scheduler also provides a monotonic frame clock for animations:
+   * tick() is fired once at the start of each drawn frame with the frame
+   * time in seconds. Loop iterations which draw nothing (a timer, a UI
+   * task or input without a redraw) neither tick nor count. An
+   * animation calls RequestAnimationFrame() in every tick it needs a
+   * following frame for.
+   *
+   * @ingroup blendint_gui
+   */
+  class FrameScheduler
+  {
+  public:
+
+    typedef std::chrono::steady_clock Clock;
+
+    FrameScheduler ();
+
+    ~FrameScheduler ();
+
+    /**
+     * @brief Request a loop iteration, can be called in any thread
+     * @return true if no request was pending, and the event loop must
+     * be woken up
+     */
+    bool RequestFrame ();
+
+    /**
+     * @brief Forget the pending request before the loop decides how
+     * long to wait, requests from now on wake up the loop again
+     */
+    inline void ClearRequest ()
+    {
+      pending_.store(false);
+    }
+
+    /**
+     * @brief Request a frame for an animation, in the main thread
+     */
+    void RequestAnimationFrame ();
+
+    /**
+     * @brief Start a frame which is going to be drawn, fires tick()
+     */
+    void BeginFrame ();
+
+    void BeginSwap ();
+
+    void EndSwap ();
+
+    void EndFrame ();
+
+    /**
+     * @brief Time to wait for events before the next frame
+     * @param[in] redraw If a window needs to be redrawn
+     * @return Seconds to wait, 0 if the next frame is due, or a negative
+     * value if no frame is needed and the loop can sleep until an event
+     */
+    double GetWaitTimeout (bool redraw) const;
+
+    /**
+     * @brief Set the refresh rate of the display in Hz
+     */
+    void SetRefreshRate (int rate);
+
+    inline void set_vsync (bool vsync)
+    {
+      vsync_ = vsync;
+    }
+
+    inline bool vsync () const
+    {
+      return vsync_;
+    }
+
+    inline bool pending () const
+    {
+      return pending_.load();
+    }
+
+    /**
+     * @brief If an animation asked for the next frame
+     */
+    inline bool animating () const
+    {
+      return animation_;
+    }
+
+    /**
+     * @brief The time of the current frame in seconds since the
+     * scheduler was created
+     */
+    inline double frame_time () const
+    {
+      return frame_time_;
+    }
+
+    /**
+     * @brief The time between the current and the previous frame in
+     * seconds
+     */
+    inline double frame_delta () const
+    {
+      return frame_delta_;
+    }
+
+    inline unsigned int frame_count () const
+    {
+      return frame_count_;
+    }
+
+    inline const FrameTiming& last_timing () const
+    {
+      return last_timing_;
+    }
+
+    /**
+     * @brief Timing averaged over the recent frames
+     */
+    inline const FrameTiming& average_timing () const
+    {
+      return average_timing_;
+    }
+
+    CppEvent::EventRef<double> tick ()
+    {
+      return tick_;
+    }
+
+  private:
+
+    static inline double milliseconds (const Clock::duration& d)
+    {
+      return std::chrono::duration<double, std::milli>(d).count();
+    }
+
+    std::atomic<bool> pending_;
+
+    // set by RequestAnimationFrame() during a frame
+    bool animation_;
+
+    bool vsync_;
+
+    Clock::duration interval_;
+
+    Clock::time_point start_;
+
+    Clock::time_point frame_start_;
+
+    Clock::time_point frame_end_;
+
+    Clock::time_point swap_start_;
+
+    bool swapped_;
+
+    double frame_time_;
+
+    double frame_delta_;
+
+    unsigned int frame_count_;
+
+    FrameTiming current_timing_;
+
+    FrameTiming last_timing_;
+
+    FrameTiming average_timing_;
+
+    CppEvent::Event<double> tick_;
+
+    // weight of a new frame in average_timing()
+    static const double kAverageWeight;
+
+    DISALLOW_COPY_AND_ASSIGN(FrameScheduler);
+  };
+
+}
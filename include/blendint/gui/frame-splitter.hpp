@@ -84,6 +84,11 @@ private:
 
   virtual Response PerformMouseHover (AbstractWindow* context) final;
 
+  /**
+   * @brief Move this handle and resize the neighbours by the recorded offset
+   */
+  void ApplyDrag (FrameSplitter* splitter);
+
   Orientation orientation_;
 
   Point last_;
@@ -93,6 +98,9 @@ private:
   int next_size_;
   int nearby_pos_;
 
+  // the cursor offset of the latest mouse move, applied in FrameSplitter::PreDraw()
+  int pending_offset_;
+
   bool hover_;
 
   bool pressed_;
@@ -250,6 +258,8 @@ private:
 
   AbstractFrame* hover_frame_;
 
+  FrameSplitterHandle* pending_handle_;
+
   AbstractFrame* focused_frame_;
 
   bool focused_;
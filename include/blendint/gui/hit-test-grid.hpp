@@ -0,0 +1,107 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <blendint/core/types.hpp>
+#include <blendint/core/rect.hpp>
+
+namespace BlendInt {
+
+  class AbstractView;
+
+  /**
+   * @brief A uniform grid over the sub widgets of a view for hit testing
+   *
+   * Each cell lists the sub widgets whose rectangles overlap it, in
+   * the sub view order, so the top most widget under a point is found
+   * by testing only the few widgets in one cell.
+   *
+   * Used by AbstractView::FindSubWidgetAt() for views with many sub
+   * widgets, see AbstractView::kHitTestGridThreshold.
+   *
+   * @ingroup blendint_gui
+   */
+  class HitTestGrid
+  {
+  public:
+
+    HitTestGrid ();
+
+    ~HitTestGrid ();
+
+    /**
+     * @brief Rebuild the grid from the sub widgets of a view
+     * @param[in] view The view whose sub widgets are indexed
+     * @param[in] stamp The geometry stamp the grid is valid for
+     *
+     * Like the linear scan it replaces, only the trailing run of
+     * widgets (iterated from the last sub view) is indexed.
+     */
+    void Build (const AbstractView* view, unsigned int stamp);
+
+    /**
+     * @brief Find the top most indexed widget which contains the point
+     * @param[in] point The position in the coordinates of the indexed view
+     */
+    AbstractView* Find (const Point& point) const;
+
+    inline unsigned int stamp () const
+    {
+      return stamp_;
+    }
+
+  private:
+
+    // widgets in sub view order, from the first indexed one
+    std::vector<AbstractView*> views_;
+
+    // per cell offsets into cell_items_, the last one is the total size
+    std::vector<int> cell_offsets_;
+
+    // indices into views_, ascending in every cell
+    std::vector<int> cell_items_;
+
+    Rect bounds_;
+
+    int columns_;
+
+    int rows_;
+
+    int cell_width_;
+
+    int cell_height_;
+
+    unsigned int stamp_;
+
+    // some views (e.g. splitter handles) accept points slightly outside
+    // of their geometry in Contain()
+    static const int kSlack = 2;
+
+    DISALLOW_COPY_AND_ASSIGN(HitTestGrid);
+
+  };
+
+}
@@ -0,0 +1,99 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <chrono>
+
+#include <blendint/core/input.hpp>
+#include <blendint/core/point.hpp>
+#include <blendint/core/size.hpp>
+
+namespace BlendInt {
+
+  enum InputEventType
+  {
+    InputEventNone = 0,
+    InputEventKey,
+    InputEventChar,
+    InputEventMouseButton,
+    InputEventCursor,
+    InputEventSize,
+    InputEventPosition
+  };
+
+  /**
+   * @brief An input or window event queued in AbstractWindow
+   *
+   * Only the fields of the event type are meaningful.
+   *
+   * @ingroup blendint_gui
+   */
+  struct InputEvent
+  {
+    typedef std::chrono::steady_clock Clock;
+
+    InputEvent (InputEventType event_type = InputEventNone)
+    : type(event_type),
+      timestamp(Clock::now()),
+      key(0),
+      scancode(0),
+      key_action(KeyNone),
+      modifiers(0),
+      character(0),
+      mouse_action(MouseNone),
+      mouse_button(MouseButtonNone)
+    {
+    }
+
+    InputEventType type;
+
+    /**
+     * @brief When the event was received from the window system
+     */
+    Clock::time_point timestamp;
+
+    // InputEventKey, also modifiers for InputEventMouseButton
+    int key;
+    int scancode;
+    KeyAction key_action;
+    int modifiers;
+
+    // InputEventChar
+    unsigned int character;
+
+    // InputEventMouseButton
+    MouseAction mouse_action;
+    MouseButton mouse_button;
+
+    // InputEventCursor, in window coordinates (origin at bottom left)
+    Point cursor;
+
+    // InputEventPosition
+    Point position;
+
+    // InputEventSize
+    Size size;
+  };
+
+}
@@ -0,0 +1,223 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <stdio.h>
+#include <stdint.h>
+#include <ctime>
+#include <vector>
+#include <deque>
+
+#include <blendint/core/types.hpp>
+#include <blendint/gui/input-event.hpp>
+
+namespace BlendInt {
+
+  /**
+   * @brief Record the input events dispatched by a window to a file
+   *
+   * Events are written in the batches ProcessInputEvents() dispatches
+   * them, with the time since the recording started, so that
+   * InputReplayer can feed the same batches back frame by frame.
+   *
+   * The file is a compact binary stream in host byte order:
+   *
+   *   - header: "BIIR" and a 32-bit version
+   *   - per frame: a 32-bit event count followed by the events
+   *   - per event: an 8-bit type, a 64-bit time offset in
+   *     microseconds and the 32-bit fields of the type
+   *
+   * @see AbstractWindow::set_input_recorder()
+   *
+   * @ingroup blendint_gui
+   */
+  class InputRecorder
+  {
+  public:
+
+    InputRecorder ();
+
+    ~InputRecorder ();
+
+    bool Open (const char* filename);
+
+    void Close ();
+
+    /**
+     * @brief Write the events of one frame
+     */
+    void Record (const std::deque<InputEvent>& events);
+
+    inline bool is_open () const
+    {
+      return file_ != 0;
+    }
+
+    inline unsigned int frame_count () const
+    {
+      return frame_count_;
+    }
+
+    static const unsigned int kVersion = 2;
+
+  private:
+
+    FILE* file_;
+
+    InputEvent::Clock::time_point start_;
+
+    unsigned int frame_count_;
+
+    DISALLOW_COPY_AND_ASSIGN(InputRecorder);
+  };
+
+  /**
+   * @brief Feed the events of a recording back into a window
+   *
+   * Every frame, the window takes the next recorded batch in
+   * AbstractWindow::ProcessInputEvents(). In real time mode a batch is
+   * held back until as much time passed as when it was recorded,
+   * otherwise one batch is replayed per frame as fast as the window
+   * draws. Live input is ignored while replaying.
+   *
+   * The CPU time and the number of view draws are measured for every
+   * frame, from taking a batch to the buffer swap.
+   *
+   * @see AbstractWindow::set_input_replayer()
+   *
+   * @ingroup blendint_gui
+   */
+  class InputReplayer
+  {
+  public:
+
+    struct FrameStats
+    {
+      int events;
+
+      // process CPU time in milliseconds
+      double cpu_time;
+
+      // wall clock time in milliseconds
+      double wall_time;
+
+      unsigned int draws;
+
+      bool presented;
+    };
+
+    InputReplayer ();
+
+    ~InputReplayer ();
+
+    /**
+     * @brief Load a file written by InputRecorder
+     */
+    bool Load (const char* filename);
+
+    /**
+     * @brief Append the next recorded batch to an input queue
+     * @return The number of events appended, 0 if the next batch is not
+     * due yet
+     */
+    int Feed (std::deque<InputEvent>& queue);
+
+    /**
+     * @brief Finish the statistics of the frame started in Feed()
+     */
+    void EndFrame (bool presented);
+
+    /**
+     * @brief Print the per frame statistics and a summary
+     */
+    void PrintStats (FILE* stream) const;
+
+    inline void set_realtime (bool realtime)
+    {
+      realtime_ = realtime;
+    }
+
+    inline bool realtime () const
+    {
+      return realtime_;
+    }
+
+    /**
+     * @brief Close the window when all batches were replayed
+     */
+    inline void set_close_when_finished (bool close)
+    {
+      close_when_finished_ = close;
+    }
+
+    inline bool close_when_finished () const
+    {
+      return close_when_finished_;
+    }
+
+    inline bool finished () const
+    {
+      return (!frame_active_) && (next_frame_ >= frames_.size());
+    }
+
+    inline const std::vector<FrameStats>& stats () const
+    {
+      return stats_;
+    }
+
+  private:
+
+    // recorded events, batches are ranges given by frames_
+    std::vector<InputEvent> events_;
+
+    // index of the first event of each batch, in events_
+    std::vector<size_t> frames_;
+
+    // time offsets of the events in microseconds
+    std::vector<uint64_t> offsets_;
+
+    std::vector<FrameStats> stats_;
+
+    size_t next_frame_;
+
+    bool realtime_;
+
+    bool close_when_finished_;
+
+    bool frame_active_;
+
+    bool started_;
+
+    InputEvent::Clock::time_point start_;
+
+    InputEvent::Clock::time_point frame_start_;
+
+    clock_t frame_cpu_start_;
+
+    unsigned int frame_draw_start_;
+
+    DISALLOW_COPY_AND_ASSIGN(InputReplayer);
+  };
+
+}
@@ -23,7 +23,7 @@
 
 #pragma once
 
-#include <deque>
+#include <vector>
 
 #include <blendint/gui/abstract-adjustment.hpp>
 
@@ -33,10 +33,35 @@ namespace BlendInt {
   {
   public:
 
+    /**
+     * @brief Scratch storage reused between adjustments
+     *
+     * A layout which adjusts its subviews frequently keeps one of
+     * these and passes it to every LinearAdjustment it creates, the
+     * vectors then keep their capacity and a steady-state layout
+     * pass does not touch the heap.
+     */
+    struct Buffer
+    {
+      void clear ()
+      {
+        expandable_preferred_width_list.clear();
+        expandable_preferred_height_list.clear();
+        unexpandable_preferred_width_list.clear();
+        unexpandable_preferred_height_list.clear();
+      }
+
+      std::vector<int> expandable_preferred_width_list;
+      std::vector<int> expandable_preferred_height_list;
+      std::vector<int> unexpandable_preferred_width_list;
+      std::vector<int> unexpandable_preferred_height_list;
+    };
+
     LinearAdjustment (AbstractView* view,
                       Orientation orient,
                       int alignment,
-                      int space);
+                      int space,
+                      Buffer* buffer = 0);
 
     virtual ~LinearAdjustment ();
 
@@ -88,10 +113,13 @@ namespace BlendInt {
 
     int space_;
 
-    std::deque<int> expandable_preferred_width_list_;
-    std::deque<int> expandable_preferred_height_list_;
-    std::deque<int> unexpandable_preferred_width_list_;
-    std::deque<int> unexpandable_preferred_height_list_;
+    // used when no external buffer is given
+    Buffer own_buffer_;
+
+    std::vector<int>& expandable_preferred_width_list_;
+    std::vector<int>& expandable_preferred_height_list_;
+    std::vector<int>& unexpandable_preferred_width_list_;
+    std::vector<int>& unexpandable_preferred_height_list_;
 
   };
 
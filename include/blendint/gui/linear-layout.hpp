@@ -24,6 +24,7 @@
 #pragma once
 
 #include <blendint/gui/abstract-layout.hpp>
+#include <blendint/gui/linear-adjustment.hpp>
 
 namespace BlendInt {
 
@@ -114,6 +115,8 @@ private:
 
   int space_;
 
+  LinearAdjustment::Buffer adjustment_buffer_;
+
 DISALLOW_COPY_AND_ASSIGN (LinearLayout);
 
 };
@@ -26,6 +26,8 @@
 #include <blendint/opengl/gl-buffer.hpp>
 
 #include <blendint/gui/font.hpp>
+#include <blendint/gui/cell-cache.hpp>
+#include <blendint/gui/row-stripes.hpp>
 #include <blendint/gui/abstract-item-view.hpp>
 
 namespace BlendInt {
@@ -66,6 +68,8 @@ public:
 
 protected:
 
+  virtual int GetRowHeight () const;
+
   virtual void PerformSizeUpdate (const AbstractView* source,
                                   const AbstractView* target,
                                   int width,
@@ -81,15 +85,20 @@ private:
 
   Font font_;
 
-  // 0 for inner buffer
-  // 1 for row_ background
-  GLuint vao_[2];
+  // for inner buffer
+  GLuint vao_;
+
+  GLBuffer<ARRAY_BUFFER, 1> vbo_;
 
-  GLBuffer<ARRAY_BUFFER, 2> vbo_;
+  RowStripes stripes_;
 
   RefPtr<AbstractItemModel> model_;
 
+  CellCache cells_;
+
   int highlight_index_;
+
+  static const float kStripeColor[4];
 };
 
 }
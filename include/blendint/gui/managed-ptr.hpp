@@ -57,10 +57,22 @@ class ManagedPtr
     if(view_) ++view_->reference_count_;
   }
 
+  /**
+   * @brief Take over the reference held by orig without touching the
+   * reference count
+   */
+  inline ManagedPtr (ManagedPtr&& orig)
+      : view_(orig.view_)
+  {
+    orig.view_ = 0;
+  }
+
   ~ManagedPtr ();
 
   ManagedPtr& operator = (const ManagedPtr& orig);
 
+  ManagedPtr& operator = (ManagedPtr&& orig);
+
   ManagedPtr& operator = (AbstractView* view);
 
   inline AbstractView* operator-> () const
@@ -123,4 +135,69 @@ class ManagedPtr
   
 };
 
+/**
+ * @brief A non-owning pointer to iterate sub views
+ *
+ * BorrowedPtr walks the sub views like ManagedPtr but never touches
+ * the reference count. Use it in loops which cannot destroy the
+ * views being iterated, like drawing, so a steady frame does not
+ * write to every view. Loops dispatching input events, where a
+ * handler may call AbstractView::Destroy(), still need ManagedPtr.
+ */
+class BorrowedPtr
+{
+ public:
+
+  inline BorrowedPtr ()
+      : view_(0)
+  {}
+
+  inline BorrowedPtr (AbstractView* view)
+      : view_(view)
+  {}
+
+  inline AbstractView* operator-> () const
+  {
+    return view_;
+  }
+
+  inline AbstractView& operator* () const
+  {
+    return *view_;
+  }
+
+  inline AbstractView* get () const
+  {
+    return view_;
+  }
+
+  inline BorrowedPtr& operator++ ()
+  {
+    if (view_) {
+      DBG_ASSERT(!view_->destroying());
+      view_ = view_->super() ? view_->super()->GetNextSubView(view_) : 0;
+    }
+    return *this;
+  }
+
+  inline BorrowedPtr& operator-- ()
+  {
+    if (view_) {
+      DBG_ASSERT(!view_->destroying());
+      view_ = view_->super() ? view_->super()->GetPreviousSubView(view_) : 0;
+    }
+    return *this;
+  }
+
+  inline operator bool () const
+  {
+    return view_ != 0;
+  }
+
+ private:
+
+  AbstractView* view_;
+
+};
+
 }
@@ -27,6 +27,7 @@
 
 #include <blendint/gui/abstract-round-frame.hpp>
 #include <blendint/gui/frame-shadow.hpp>
+#include <blendint/gui/linear-adjustment.hpp>
 
 #include <blendint/gui/menu-item.hpp>
 #include <blendint/gui/push-button.hpp>
@@ -151,6 +152,8 @@ private:
 
   int space_;
 
+  LinearAdjustment::Buffer adjustment_buffer_;
+
   bool hover_;
 
   bool pressed_;
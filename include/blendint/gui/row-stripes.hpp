@@ -0,0 +1,103 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <blendint/core/types.hpp>
+#include <blendint/opengl/gl-buffer.hpp>
+
+namespace BlendInt {
+
+  /**
+   * @brief Draw the zebra stripes of a list-like view in one call
+   *
+   * Every stripe is an instance of the same row quad, the y offset
+   * and the gamma (even, odd or highlighted row) of each stripe are
+   * per-instance attributes uploaded once per frame.
+   *
+   * Each view owns a RowStripes, call Resize() when the width or row
+   * height changes and Draw() inside the inner stencil.
+   */
+  class RowStripes
+  {
+  public:
+
+    RowStripes ();
+
+    ~RowStripes ();
+
+    /**
+     * @brief Update the quad of one stripe
+     */
+    void Resize (int width, int row_height);
+
+    /**
+     * @brief Draw stripes from a row down to the bottom of the view
+     * @param[in] first The row of the top most stripe, used for the
+     * even/odd gamma
+     * @param[in] y The bottom of the top most stripe in local
+     * coordinates
+     * @param[in] highlight The highlighted row, -1 for none
+     * @param[in] color The base color of stripes
+     */
+    void Draw (int first, int y, int highlight, const float* color);
+
+    inline int row_height () const
+    {
+      return row_height_;
+    }
+
+    /**
+     * @brief Instances drawn by the last Draw()
+     */
+    inline size_t instance_count () const
+    {
+      return instances_.size() / 2;
+    }
+
+    static const int kEvenGamma = 0;
+
+    static const int kOddGamma = 15;
+
+    static const int kHighlightGamma = -35;
+
+  private:
+
+    GLuint vao_;
+
+    // 0: the row quad, 1: y offset and gamma per instance
+    GLBuffer<ARRAY_BUFFER, 2> vbo_;
+
+    std::vector<GLfloat> instances_;
+
+    // instances the buffer can hold without re-allocating
+    size_t capacity_;
+
+    int row_height_;
+
+    DISALLOW_COPY_AND_ASSIGN(RowStripes);
+  };
+
+}
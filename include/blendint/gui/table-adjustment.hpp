@@ -24,7 +24,6 @@
 #pragma once
 
 #include <vector>
-#include <deque>
 
 #include <blendint/gui/abstract-adjustment.hpp>
 
@@ -34,7 +33,19 @@ namespace BlendInt {
 	{
 	public:
 
-		TableAdjustment (AbstractView* view, unsigned int row, unsigned int column, int space);
+		/**
+		 * @brief Per-row and per-column scratch storage reused between adjustments
+		 */
+		struct Buffer
+		{
+			std::vector<bool> column_expand_status;
+			std::vector<bool> row_expand_status;
+
+			std::vector<int> column_width_list;
+			std::vector<int> row_height_list;
+		};
+
+		TableAdjustment (AbstractView* view, unsigned int row, unsigned int column, int space, Buffer* buffer = 0);
 
 		virtual ~TableAdjustment ();
 
@@ -64,11 +75,14 @@ namespace BlendInt {
 
 		int space_;
 
-		std::vector<bool> column_expand_status_;
-		std::vector<bool> row_expand_status_;
+		// used when no external buffer is given
+		Buffer own_buffer_;
+
+		std::vector<bool>& column_expand_status_;
+		std::vector<bool>& row_expand_status_;
 
-		std::vector<int> column_width_list_;
-		std::vector<int> row_height_list_;
+		std::vector<int>& column_width_list_;
+		std::vector<int>& row_height_list_;
 
 		int total_fixed_column_width_;
 		int total_fixed_row_height_;
@@ -24,6 +24,7 @@
 #pragma once
 
 #include <blendint/gui/abstract-layout.hpp>
+#include <blendint/gui/table-adjustment.hpp>
 
 namespace BlendInt {
 
@@ -107,6 +108,8 @@ private:
   unsigned int column_;
 
   int space_;
+
+  TableAdjustment::Buffer adjustment_buffer_;
 };
 
 }
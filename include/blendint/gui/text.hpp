@@ -27,12 +27,19 @@
 
 #include <blendint/core/string.hpp>
 #include <blendint/core/color.hpp>
+#include <blendint/core/object-pool.hpp>
 #include <blendint/opengl/gl-buffer.hpp>
 #include <blendint/gui/font.hpp>
 
 namespace BlendInt {
 
-  class Text: public AbstractForm
+  /**
+   * @brief A string drawn with a font
+   *
+   * Models create one Text per cell, so Text objects come from a
+   * per-type pool (see PoolAllocated).
+   */
+  class Text: public AbstractForm, public PoolAllocated<Text>
   {
   public:
 
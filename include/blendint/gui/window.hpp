@@ -28,6 +28,7 @@
 #include <GLFW/glfw3.h>
 
 #include <blendint/core/string.hpp>
+#include <blendint/core/wakeup-signal.hpp>
 #include <blendint/gui/abstract-window.hpp>
 #include <blendint/gui/abstract-cursor-theme.hpp>
 
@@ -82,6 +83,15 @@ public:
     return resized_;
   }
 
+  /**
+   * @brief The descriptor used to wake up the event loop, its counters
+   * show how many requests were merged into one wakeup
+   */
+  static inline const WakeupSignal* wakeup_signal ()
+  {
+    return &kWakeupSignal;
+  }
+
   static bool Initialize ();
 
   static void Terminate ();
@@ -104,12 +114,63 @@ private:
 
   void Close ();
 
+  /**
+   * @brief Find the Window of a GLFW window in callbacks
+   */
+  static Window* FindWindow (GLFWwindow* window);
+
+  /**
+   * @brief Wake up the event loop, can be called in any thread
+   */
+  static void Wakeup ();
+
+  /**
+   * @brief Wait for window system events or Wakeup()
+   * @param[in] timeout Seconds to wait at most, 0 to only poll, or a
+   * negative value to wait without a limit
+   */
+  static void WaitEvents (double timeout);
+
+#ifdef __USE_X11__
+  static bool HasX11Display ();
+
+  /**
+   * @brief Poll the X connection and kWakeupSignal together, then
+   * process the events with GLFW, see window-x11.cpp
+   */
+  static void WaitX11Events (double timeout);
+#endif
+
+  /**
+   * @brief Time to wait for events before the next frame or timer
+   * @see FrameScheduler::GetWaitTimeout()
+   */
+  static double GetWaitTimeout ();
+
+  /**
+   * @brief If any window has input events queued
+   */
+  static bool HasInputEvents ();
+
+  /**
+   * @brief If any visible window needs to be redrawn
+   */
+  static bool HasPendingRedraw ();
+
+  /**
+   * @brief Draw the windows which need a redraw as one frame
+   */
+  static void DrawFrame ();
+
   GLFWwindow* window_;
 
   bool running_;
 
   bool visible_;
 
+  // the latest height from GLFW, used to flip the cursor position
+  int input_height_;
+
   CppEvent::Event<const Size&> resized_;
 
   static GLFWcursor* kArrowCursor;
@@ -128,21 +189,10 @@ private:
 
   static std::map<GLFWwindow*, Window*> kSharedWindowMap;
 
-  static KeyAction kKeyAction;
-
-  static int kKey;
-
-  static int kModifiers;
-
-  static int kScancode;
-
-  static String kText;
-
-  static MouseAction kMouseAction;
-
-  static MouseButton kMouseButton;
+  static WakeupSignal kWakeupSignal;
 
-  static Point kCursor;
+  // if the loop waits on kWakeupSignal instead of GLFW empty events
+  static bool kWaitOnDescriptor;
 
   static void CbError (int error, const char* description);
 
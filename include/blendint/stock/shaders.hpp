@@ -36,7 +36,7 @@ namespace BlendInt {
 
 enum AttributeLayout
 {
-  AttributeCoord = 0, AttributeColor = 1, AttributeUV = 1
+  AttributeCoord = 0, AttributeColor = 1, AttributeUV = 1, AttributeInstance = 2
 };
 
 /**
@@ -68,6 +68,11 @@ class Shaders
     WIDGET_SIMPLE_TRIANGLE_COLOR,
     WIDGET_SIMPLE_TRIANGLE_GAMMA,
 
+    // Instanced row stripes
+    WIDGET_STRIPE_COORD,
+    WIDGET_STRIPE_INSTANCE,	// vec2 of y offset and gamma per stripe
+    WIDGET_STRIPE_COLOR,
+
     WIDGET_INNER_COORD,
     WIDGET_INNER_COLOR,
     WIDGET_INNER_GAMMA,
@@ -168,6 +173,11 @@ class Shaders
     return widget_simple_triangle_program_;
   }
 
+  inline const RefPtr<GLSLProgram>& widget_stripe_program () const
+  {
+    return widget_stripe_program_;
+  }
+
   inline const RefPtr<GLSLProgram>& widget_inner_program () const
   {
     return widget_inner_program_;
@@ -311,6 +321,8 @@ class Shaders
 
   bool SetupWidgetSimpleTriangleProgram ();
 
+  bool SetupWidgetStripeProgram ();
+
   bool SetupWidgetImageProgram ();
 
   bool SetupWidgetLineProgram ();
@@ -337,6 +349,8 @@ class Shaders
 
   RefPtr<GLSLProgram> widget_simple_triangle_program_;
 
+  RefPtr<GLSLProgram> widget_stripe_program_;
+
   RefPtr<GLSLProgram> widget_inner_program_;
 
   RefPtr<GLSLProgram> widget_split_inner_program_;
@@ -416,6 +430,10 @@ class Shaders
 
   static const char* widget_simple_triangle_fragment_shader;
 
+  static const char* widget_stripe_vertex_shader;
+
+  static const char* widget_stripe_fragment_shader;
+
   static const char* widget_inner_vertex_shader;
 
   static const char* widget_inner_fragment_shader;
@@ -0,0 +1,153 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <stdlib.h>
+
+#include <blendint/core/object-pool.hpp>
+
+namespace BlendInt {
+
+  FixedPool* FixedPool::kFirstPool = 0;
+
+  FixedPool::FixedPool (const char* name, size_t block_size, size_t blocks_per_chunk)
+  : name_(name),
+    block_size_(0),
+    blocks_per_chunk_(blocks_per_chunk > 0 ? blocks_per_chunk : 1),
+    chunk_size_(0),
+    chunks_(0),
+    free_blocks_(0),
+    live_count_(0),
+    peak_count_(0),
+    chunk_count_(0),
+    previous_(0),
+    next_(0)
+  {
+    if (block_size < sizeof(FreeBlock)) block_size = sizeof(FreeBlock);
+    block_size_ = (block_size + kAlignment - 1) / kAlignment * kAlignment;
+
+    // the chunk header takes one alignment unit
+    chunk_size_ = kAlignment + block_size_ * blocks_per_chunk_;
+
+    if (kFirstPool) {
+      kFirstPool->previous_ = this;
+      next_ = kFirstPool;
+    }
+    kFirstPool = this;
+  }
+
+  FixedPool::~FixedPool ()
+  {
+#ifdef DEBUG
+    if (live_count_ > 0) {
+      DBG_PRINT_MSG("Warning: pool %s destroyed with %ld blocks in use",
+                    name_, (long)live_count_);
+    }
+#endif
+
+    live_count_ = 0;
+    Release();
+
+    if (previous_) previous_->next_ = next_;
+    else kFirstPool = next_;
+    if (next_) next_->previous_ = previous_;
+  }
+
+  void* FixedPool::Allocate ()
+  {
+    if (free_blocks_ == 0) Grow();
+
+    FreeBlock* block = free_blocks_;
+    free_blocks_ = block->next;
+
+    live_count_++;
+    if (live_count_ > peak_count_) peak_count_ = live_count_;
+
+    return block;
+  }
+
+  void FixedPool::Deallocate (void* p)
+  {
+    if (p == 0) return;
+
+    DBG_ASSERT(live_count_ > 0);
+
+    FreeBlock* block = static_cast<FreeBlock*>(p);
+    block->next = free_blocks_;
+    free_blocks_ = block;
+
+    live_count_--;
+  }
+
+  void FixedPool::Release ()
+  {
+    DBG_ASSERT(live_count_ == 0);
+
+    Chunk* chunk = chunks_;
+    Chunk* next = 0;
+    while (chunk) {
+      next = chunk->next;
+      free(chunk);
+      chunk = next;
+    }
+
+    chunks_ = 0;
+    free_blocks_ = 0;
+    chunk_count_ = 0;
+  }
+
+  void FixedPool::PrintStats (FILE* fp)
+  {
+    fprintf(fp, "%-32s %8s %10s %10s %8s %12s\n", "pool", "block", "live",
+            "peak", "chunks", "bytes");
+
+    for (FixedPool* p = kFirstPool; p; p = p->next_) {
+      fprintf(fp, "%-32s %8ld %10ld %10ld %8ld %12ld\n",
+              p->name_ ? p->name_ : "(unnamed)",
+              (long)p->block_size_,
+              (long)p->live_count_,
+              (long)p->peak_count_,
+              (long)p->chunk_count_,
+              (long)p->reserved_bytes());
+    }
+  }
+
+  void FixedPool::Grow ()
+  {
+    char* memory = static_cast<char*>(malloc(chunk_size_));
+    if (memory == 0) throw std::bad_alloc();
+
+    Chunk* chunk = reinterpret_cast<Chunk*>(memory);
+    chunk->next = chunks_;
+    chunks_ = chunk;
+    chunk_count_++;
+
+    // chain the blocks lowest address first
+    char* first = memory + kAlignment;
+    for (size_t i = blocks_per_chunk_; i > 0; i--) {
+      FreeBlock* block = reinterpret_cast<FreeBlock*>(first + (i - 1) * block_size_);
+      block->next = free_blocks_;
+      free_blocks_ = block;
+    }
+  }
+
+}
@@ -0,0 +1,292 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <blendint/core/thread-pool.hpp>
+
+namespace BlendInt {
+
+  // the pool and index of the worker running in this thread
+  static thread_local ThreadPool* current_pool = 0;
+  static thread_local unsigned int current_worker = 0;
+
+  void FutureStateBase::Wait ()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this] () { return ready_; });
+  }
+
+  void FutureStateBase::WaitResult ()
+  {
+    std::exception_ptr error;
+
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] () { return ready_; });
+      error = error_;
+    }
+
+    if (error) std::rethrow_exception(error);
+  }
+
+  void FutureStateBase::Finish (bool cancelled,
+                                const std::exception_ptr& error)
+  {
+    std::function<void()> continuation;
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ready_ = true;
+      cancelled_ = cancelled;
+      error_ = error;
+      continuation.swap(continuation_);
+    }
+
+    condition_.notify_all();
+
+    if (continuation) ThreadPool::DispatchToMainThread(continuation);
+  }
+
+  void FutureStateBase::SetContinuation (
+      const std::function<void()>& continuation)
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (!ready_) {
+        continuation_ = continuation;
+        return;
+      }
+    }
+
+    ThreadPool::DispatchToMainThread(continuation);
+  }
+
+  bool FutureStateBase::ready ()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return ready_;
+  }
+
+  bool FutureStateBase::cancelled ()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return cancelled_;
+  }
+
+  bool FutureStateBase::failed ()
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return error_ ? true : false;
+  }
+
+  // ---------------------------------------------------------------
+
+  ThreadPool* ThreadPool::kGlobal = 0;
+
+  std::function<void(const std::function<void()>&)> ThreadPool::kDispatcher;
+
+  ThreadPool::ThreadPool (unsigned int workers)
+  : queued_count_(0),
+    next_worker_(0),
+    finished_count_(0),
+    stolen_count_(0),
+    total_latency_(0),
+    total_run_time_(0),
+    stopping_(false)
+  {
+    if (workers == 0) {
+      unsigned int cores = std::thread::hardware_concurrency();
+      workers = cores > 1 ? cores - 1 : 1;
+    }
+
+    // all queues exist before any worker may steal from them
+    for (unsigned int i = 0; i < workers; i++) {
+      workers_.push_back(new Worker);
+    }
+
+    for (unsigned int i = 0; i < workers; i++) {
+      workers_[i]->thread = std::thread(&ThreadPool::Run, this, i);
+    }
+  }
+
+  ThreadPool::~ThreadPool ()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stopping_ = true;
+    }
+    condition_.notify_all();
+
+    for (size_t i = 0; i < workers_.size(); i++) {
+      workers_[i]->thread.join();
+    }
+
+    for (size_t i = 0; i < workers_.size(); i++) {
+      delete workers_[i];
+    }
+  }
+
+  double ThreadPool::GetAverageLatency () const
+  {
+    unsigned int count = finished_count_.load();
+    return count > 0 ? total_latency_.load() / 1000.0 / count : 0.0;
+  }
+
+  double ThreadPool::GetAverageRunTime () const
+  {
+    unsigned int count = finished_count_.load();
+    return count > 0 ? total_run_time_.load() / 1000.0 / count : 0.0;
+  }
+
+  void ThreadPool::Initialize (unsigned int workers)
+  {
+    if (kGlobal == 0) kGlobal = new ThreadPool(workers);
+  }
+
+  void ThreadPool::Release ()
+  {
+    delete kGlobal;
+    kGlobal = 0;
+  }
+
+  void ThreadPool::SetMainThreadDispatcher (
+      const std::function<void(const std::function<void()>&)>& dispatcher)
+  {
+    kDispatcher = dispatcher;
+  }
+
+  void ThreadPool::DispatchToMainThread (const std::function<void()>& task)
+  {
+    if (kDispatcher) {
+      kDispatcher(task);
+    } else {
+      task();
+    }
+  }
+
+  void ThreadPool::Push (const std::function<void()>& function,
+                         TaskPriority priority)
+  {
+    DBG_ASSERT(priority >= TaskPriorityLow && priority < TaskPriorityCount);
+
+    unsigned int index;
+    if (current_pool == this) {
+      index = current_worker;
+    } else {
+      index = next_worker_++ % workers_.size();
+    }
+
+    Job job;
+    job.function = function;
+    job.submitted = std::chrono::steady_clock::now();
+
+    Worker* worker = workers_[index];
+    {
+      std::lock_guard<std::mutex> lock(worker->mutex);
+      worker->queues[priority].push_back(job);
+    }
+
+    {
+      // so that a worker going to sleep does not miss it
+      std::lock_guard<std::mutex> lock(mutex_);
+      queued_count_++;
+    }
+    condition_.notify_one();
+  }
+
+  bool ThreadPool::Pop (unsigned int index, Job* job)
+  {
+    size_t count = workers_.size();
+
+    for (int p = TaskPriorityCount - 1; p >= 0; p--) {
+
+      // the most recent task of this worker
+      {
+        Worker* worker = workers_[index];
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (!worker->queues[p].empty()) {
+          *job = worker->queues[p].back();
+          worker->queues[p].pop_back();
+          queued_count_--;
+          return true;
+        }
+      }
+
+      // or the oldest one of others
+      for (size_t i = 1; i < count; i++) {
+        Worker* worker = workers_[(index + i) % count];
+        std::lock_guard<std::mutex> lock(worker->mutex);
+        if (!worker->queues[p].empty()) {
+          *job = worker->queues[p].front();
+          worker->queues[p].pop_front();
+          queued_count_--;
+          stolen_count_++;
+          return true;
+        }
+      }
+
+    }
+
+    return false;
+  }
+
+  void ThreadPool::Run (unsigned int index)
+  {
+    current_pool = this;
+    current_worker = index;
+
+    Job job;
+
+    while (true) {
+
+      if (Pop(index, &job)) {
+
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+
+        job.function();
+        job.function = nullptr;
+
+        std::chrono::steady_clock::time_point end =
+            std::chrono::steady_clock::now();
+
+        total_latency_ += std::chrono::duration_cast<
+            std::chrono::microseconds>(start - job.submitted).count();
+        total_run_time_ += std::chrono::duration_cast<
+            std::chrono::microseconds>(end - start).count();
+        finished_count_++;
+
+        continue;
+      }
+
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this] () {
+        return stopping_ || (queued_count_.load() > 0);
+      });
+
+      if (stopping_ && (queued_count_.load() == 0)) break;
+    }
+
+    current_pool = 0;
+  }
+
+}
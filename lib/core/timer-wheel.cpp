@@ -0,0 +1,262 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <blendint/core/timer.hpp>
+#include <blendint/core/timer-wheel.hpp>
+
+namespace BlendInt {
+
+  TimerWheel::TimerWheel ()
+  : firing_(0),
+    current_(0),
+    size_(0),
+    fired_count_(0),
+    missed_count_(0),
+    total_lateness_(0.0),
+    max_lateness_(0.0)
+  {
+    for (int i = 0; i < kLevels; i++) {
+      masks_[i] = 0;
+      for (int j = 0; j < kSlots; j++) {
+        slots_[i][j] = 0;
+      }
+    }
+
+    start_ = Clock::now();
+  }
+
+  TimerWheel::~TimerWheel ()
+  {
+  }
+
+  void TimerWheel::Schedule (Timer* timer)
+  {
+    DBG_ASSERT(timer);
+
+    if (timer->wheel_level_ >= 0) Unlink(timer);
+
+    // catch up first, so the interval counts from now
+    uint64_t now = GetTicks();
+    if (size_ == 0 && now > current_) current_ = now;
+
+    unsigned int interval = timer->interval_ > 0 ? timer->interval_ : 1;
+    timer->expires_ = now + interval;
+
+    Insert(timer);
+  }
+
+  void TimerWheel::Cancel (Timer* timer)
+  {
+    DBG_ASSERT(timer);
+
+    if (timer->wheel_level_ >= 0) Unlink(timer);
+  }
+
+  void TimerWheel::Advance ()
+  {
+    uint64_t now = GetTicks();
+
+    while (current_ < now) {
+
+      if (size_ == 0) {
+        current_ = now;
+        break;
+      }
+
+      // jump to the next non-empty slot of the lowest level, or to the
+      // end of its turn where higher levels cascade
+      uint64_t base = current_ & ~((uint64_t) (kSlots - 1));
+      uint64_t next = base + kSlots;
+      int index = (int) (current_ & (kSlots - 1));
+
+      uint64_t mask = index < (kSlots - 1) ?
+          (masks_[0] & (~((uint64_t) 0) << (index + 1))) : 0;
+      if (mask) {
+        next = base + __builtin_ctzll(mask);
+      }
+
+      if (next > now) {
+        current_ = now;
+        break;
+      }
+
+      current_ = next;
+      index = (int) (current_ & (kSlots - 1));
+
+      if (index == 0) {
+        int level = 1;
+        uint64_t ticks = current_;
+        do {
+          ticks >>= kSlotBits;
+          Cascade(level);
+          level++;
+        } while ((level < kLevels) && ((ticks & (kSlots - 1)) == 0));
+      }
+
+      // move the slot aside, timers may be started or stopped by the
+      // callbacks
+      firing_ = slots_[0][index];
+      slots_[0][index] = 0;
+      masks_[0] &= ~((uint64_t) 1 << index);
+      for (Timer* p = firing_; p; p = p->wheel_next_) {
+        p->wheel_level_ = kLevels;
+      }
+
+      while (firing_) {
+
+        Timer* timer = firing_;
+        Unlink(timer);
+
+        double lateness = std::chrono::duration<double, std::milli>(
+            Clock::now() - start_).count() - (double) timer->expires_;
+        if (lateness < 0.0) lateness = 0.0;
+
+        fired_count_++;
+        total_lateness_ += lateness;
+        if (lateness > max_lateness_) max_lateness_ = lateness;
+
+        // reschedule before the callback, which may stop the timer
+        unsigned int interval = timer->interval_ > 0 ? timer->interval_ : 1;
+        timer->expires_ += interval;
+        if (timer->expires_ <= now) {
+          missed_count_ += (unsigned int) ((now - timer->expires_) / interval) + 1;
+          timer->expires_ = now + interval;
+        }
+        Insert(timer);
+
+        timer->timeout_.Invoke();
+      }
+
+    }
+  }
+
+  double TimerWheel::GetWaitTimeout () const
+  {
+    if (size_ == 0) return -1.0;
+
+    uint64_t base = current_ & ~((uint64_t) (kSlots - 1));
+    uint64_t next = base + kSlots;
+    int index = (int) (current_ & (kSlots - 1));
+
+    uint64_t mask = index < (kSlots - 1) ?
+        (masks_[0] & (~((uint64_t) 0) << (index + 1))) : 0;
+    if (mask) {
+      next = base + __builtin_ctzll(mask);
+    }
+
+    double wait = (double) next - std::chrono::duration<double, std::milli>(
+        Clock::now() - start_).count();
+
+    return wait > 0.0 ? wait / 1000.0 : 0.0;
+  }
+
+  void TimerWheel::ResetStats ()
+  {
+    fired_count_ = 0;
+    missed_count_ = 0;
+    total_lateness_ = 0.0;
+    max_lateness_ = 0.0;
+  }
+
+  uint64_t TimerWheel::GetTicks () const
+  {
+    return (uint64_t) std::chrono::duration_cast<std::chrono::milliseconds>(
+        Clock::now() - start_).count();
+  }
+
+  void TimerWheel::Insert (Timer* timer)
+  {
+    // a timer cascaded down at its due tick goes to the slot being fired
+    uint64_t expires = timer->expires_;
+    if (expires < current_) expires = current_;
+
+    uint64_t delta = expires - current_;
+
+    int level = 0;
+    while ((level < (kLevels - 1))
+        && (delta >= ((uint64_t) 1 << (kSlotBits * (level + 1))))) {
+      level++;
+    }
+
+    if (delta >= ((uint64_t) 1 << (kSlotBits * kLevels))) {
+      // beyond the wheel, wait in the last slot and cascade again
+      expires = current_ + ((uint64_t) 1 << (kSlotBits * kLevels)) - 1;
+    }
+
+    int slot = (int) ((expires >> (kSlotBits * level)) & (kSlots - 1));
+
+    timer->wheel_level_ = level;
+    timer->wheel_slot_ = slot;
+    timer->wheel_previous_ = 0;
+    timer->wheel_next_ = slots_[level][slot];
+    if (timer->wheel_next_) timer->wheel_next_->wheel_previous_ = timer;
+    slots_[level][slot] = timer;
+    masks_[level] |= (uint64_t) 1 << slot;
+
+    size_++;
+  }
+
+  void TimerWheel::Unlink (Timer* timer)
+  {
+    int level = timer->wheel_level_;
+    int slot = timer->wheel_slot_;
+    Timer** first = head(level, slot);
+
+    if (timer->wheel_previous_) {
+      timer->wheel_previous_->wheel_next_ = timer->wheel_next_;
+    } else {
+      *first = timer->wheel_next_;
+    }
+
+    if (timer->wheel_next_) {
+      timer->wheel_next_->wheel_previous_ = timer->wheel_previous_;
+    }
+
+    if ((level < kLevels) && (*first == 0)) {
+      masks_[level] &= ~((uint64_t) 1 << slot);
+    }
+
+    timer->wheel_previous_ = 0;
+    timer->wheel_next_ = 0;
+    timer->wheel_level_ = -1;
+
+    size_--;
+  }
+
+  void TimerWheel::Cascade (int level)
+  {
+    int slot = (int) ((current_ >> (kSlotBits * level)) & (kSlots - 1));
+
+    Timer* p = slots_[level][slot];
+    slots_[level][slot] = 0;
+    masks_[level] &= ~((uint64_t) 1 << slot);
+
+    while (p) {
+      Timer* next = p->wheel_next_;
+      size_--;
+      Insert(p);
+      p = next;
+    }
+  }
+
+}
@@ -28,12 +28,8 @@
 #include <sys/time.h>
 #endif	// __UNIX__
 
-#include <errno.h>
-#include <string.h>
-
-#include <iostream>
-
 #include <blendint/core/timer.hpp>
+#include <blendint/core/timer-wheel.hpp>
 
 namespace BlendInt {
 
@@ -43,90 +39,33 @@ uint64_t Timer::kProgramTime = 0;
 
 Timer::Timer()
     : Object(),
-#if BLENDINT_USE_POSIX_TIMER
-      m_id (0),
-#endif
       interval_(40),
-      enabled_(false)
+      enabled_(false),
+      expires_(0),
+      wheel_previous_(0),
+      wheel_next_(0),
+      wheel_level_(-1),
+      wheel_slot_(0)
 {
-#if BLENDINT_USE_POSIX_TIMER
-  Create();
-#endif
 }
 
 Timer::~Timer()
 {
-#if BLENDINT_USE_POSIX_TIMER
-  timer_delete(m_id);
-#else
   Stop();
-#endif
 }
 
 void Timer::Start ()
 {
-  int ret = -1;
-
-#if BLENDINT_USE_POSIX_TIMER
-  struct itimerspec ts;
-
-  unsigned int sec = interval_ / 1000;
-  long nsec = (interval_ % 1000) * 1000 * 1000;
-
-  ts.it_interval.tv_sec = sec;
-  ts.it_interval.tv_nsec = nsec;
-  ts.it_value.tv_sec = sec;
-  ts.it_value.tv_nsec = nsec;
-
-  ret = timer_settime(m_id, 0, &ts, 0);
-
-  if(ret < 0) {
-    std::cerr << "Fail to start timer in " << __func__ << std::endl;
-    enabled_ = false;
-  } else {
-    enabled_ = true;
-  }
-#else
-  if(enabled_) Stop();
-		
-  // Create a thread		
-  ret = pthread_create (&m_id, NULL, Timer::ThreadCallback, this);
-  if(ret == 0) {
-    enabled_ = true;
-  } else {
-    std::cerr << "Fail to start timer in " << __func__ << std::endl;
-    enabled_ = false;
-  }
-#endif
-
+  wheel()->Schedule(this);
+  enabled_ = true;
 }
 
 void Timer::Stop ()
 {
-#if BLENDINT_USE_POSIX_TIMER
-  if(! enabled_) return;
-
-  int ret = -1;
-  struct itimerspec ts;
-  memset (&ts, 0, sizeof(ts));
-
-  ret = timer_settime(m_id, 0, &ts, 0);
-
-  if(ret < 0) {
-    std::cerr << "Fail to stop timer in " << __func__ << std::endl;
-  }
-
-  enabled_ = false;
-#else
   if(enabled_) {
-    int ret = pthread_cancel(m_id);
-    if(ret != 0) {
-      std::cerr << "Error: Fail to cancel the timer thread!" << std::endl;
-    }
-			
+    wheel()->Cancel(this);
     enabled_ = false;
   }
-#endif
 }
 
 void Timer::SetInterval(unsigned int interval)
@@ -135,14 +74,7 @@ void Timer::SetInterval(unsigned int interval)
 
   interval_ = interval;
 
-#if BLENDINT_USE_POSIX_TIMER
-  if(enabled_) Start ();
-#else
-  if(enabled_) {
-    Stop();
-    Start();
-  }
-#endif
+  if(enabled_) Start();
 }
 
 double Timer::GetIntervalOfSeconds()
@@ -209,65 +141,10 @@ void Timer::SaveProgramTime ()
   kProgramTime = GetMicroSeconds();
 }
 
-#if BLENDINT_USE_POSIX_TIMER
-
-void Timer::Create()
-{
-  int ret = -1;
-  struct sigevent sev;
-  sev.sigev_notify = SIGEV_THREAD;
-  sev.sigev_value.sival_ptr = this;
-  sev.sigev_notify_function = ThreadCallback;
-  sev.sigev_notify_attributes = 0;
-
-  ret = timer_create(CLOCK_REALTIME, &sev, &m_id);
-  if(ret < 0) {
-    // do error
-    std::cerr << "Fail to create timer in " << __func__ << std::endl;
-    if(ret == EAGAIN) {
-      std::cerr << "The calling process has already created all of the timers it is allowed by this implementation" << std::endl;
-    }
-  }
-
-}
-
-void Timer::ThreadCallback(union sigval sigev_value)
-{
-  Timer* timer = static_cast<Timer*>(sigev_value.sival_ptr);
-  timer->timeout_.Invoke();
-}
-
-#else
-
-void *Timer::ThreadCallback (void* data)
+TimerWheel* Timer::wheel ()
 {
-  Timer* timer = static_cast<Timer*>(data);
-  struct timespec ts;
-  // int ret = 0;
-
-  pthread_detach(pthread_self());
-
-  unsigned int sec = timer->interval_ / 1000;
-  long nsec = (timer->interval_ % 1000) * 1000 * 1000;
-
-  ts.tv_sec = sec;
-  ts.tv_nsec = nsec;
-
-  while(true) {
-    // TODO: call nanosleep()
-    //ret = nanosleep (&ts, NULL);
-    nanosleep (&ts, NULL);
-
-    if(timer->enabled()) {
-      timer->timeout_.Invoke();
-    } else {
-      break;
-    }
-  }
-
-  pthread_exit(NULL);
+  static TimerWheel wheel;
+  return &wheel;
 }
 
-#endif	// BLENDINT_USE_POSIX_TIMER
-
 }
@@ -0,0 +1,107 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <blendint/config.hpp>
+
+#ifdef __UNIX__
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef __LINUX__
+#include <sys/eventfd.h>
+#endif
+
+#include <stdint.h>
+
+#include <blendint/core/wakeup-signal.hpp>
+
+namespace BlendInt {
+
+  WakeupSignal::WakeupSignal ()
+  : signaled_(false), request_count_(0), signal_count_(0)
+  {
+    fds_[0] = -1;
+    fds_[1] = -1;
+
+#if defined(__LINUX__)
+    fds_[0] = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    fds_[1] = fds_[0];
+#elif defined(__UNIX__)
+    if (pipe(fds_) == 0) {
+      for (int i = 0; i < 2; i++) {
+        fcntl(fds_[i], F_SETFL, fcntl(fds_[i], F_GETFL) | O_NONBLOCK);
+        fcntl(fds_[i], F_SETFD, FD_CLOEXEC);
+      }
+    } else {
+      fds_[0] = -1;
+      fds_[1] = -1;
+    }
+#endif
+
+    if (fds_[0] < 0) {
+      DBG_PRINT_MSG("Warning: %s", "cannot create the wakeup descriptor");
+    }
+  }
+
+  WakeupSignal::~WakeupSignal ()
+  {
+#ifdef __UNIX__
+    if (fds_[0] >= 0) close(fds_[0]);
+    if ((fds_[1] >= 0) && (fds_[1] != fds_[0])) close(fds_[1]);
+#endif
+  }
+
+  bool WakeupSignal::Signal ()
+  {
+    request_count_++;
+
+    if (fds_[1] < 0) return false;
+    if (signaled_.exchange(true)) return false;
+
+    signal_count_++;
+
+#ifdef __UNIX__
+    uint64_t one = 1;
+    ssize_t ret = write(fds_[1], &one, sizeof(one));
+    (void) ret;   // a full pipe or counter still wakes up the loop
+#endif
+
+    return true;
+  }
+
+  void WakeupSignal::Clear ()
+  {
+    if (fds_[0] < 0) return;
+
+#ifdef __UNIX__
+    uint64_t buf[8];
+    while (read(fds_[0], buf, sizeof(buf)) > 0) {
+    }
+#endif
+
+    // after draining, so that a Signal() from now on writes again
+    signaled_.store(false);
+  }
+
+}
@@ -25,6 +25,7 @@
  */
 
 #include <cppevent/abstract-trackable.hpp>
+#include <cppevent/connection.hpp>
 
 namespace CppEvent {
 
@@ -64,13 +65,7 @@ Binding::~Binding()
 
 Token::~Token()
 {
-  if (trackable_object) trackable_object->AuditDestroyingToken(this);
-
-  if (previous) previous->next = next;
-  if (next) next->previous = previous;
-
-  previous = 0;
-  next = 0;
+  Detach();
 
   if (binding) {
 #ifdef DEBUG
@@ -80,6 +75,24 @@ Token::~Token()
     delete binding;
     binding = 0;
   }
+
+  if (state) {
+    state->token = 0;
+    ConnectionState::Release(state);
+    state = 0;
+  }
+}
+
+void Token::Detach ()
+{
+  if (trackable_object) trackable_object->AuditDestroyingToken(this);
+  trackable_object = 0;
+
+  if (previous) previous->next = next;
+  if (next) next->previous = previous;
+
+  previous = 0;
+  next = 0;
 }
 
 AbstractTrackable::~AbstractTrackable ()
@@ -0,0 +1,95 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Freeman Zhang <zhanggyb@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cppevent/connection.hpp>
+#include <cppevent/abstract-trackable.hpp>
+
+namespace CppEvent {
+
+void ConnectionState::Retain (ConnectionState* state)
+{
+  if (state) state->ref_count++;
+}
+
+void ConnectionState::Release (ConnectionState* state)
+{
+  if (state == 0) return;
+
+#ifdef DEBUG
+  assert(state->ref_count > 0);
+#endif
+
+  state->ref_count--;
+  if (state->ref_count == 0) delete state;
+}
+
+Connection::Connection (Token* token)
+    : state_(0)
+{
+  if (token == 0) return;
+
+  if (token->state == 0) {
+    token->state = new ConnectionState;
+    token->state->token = token;
+    ConnectionState::Retain(token->state);  // held by the token
+  }
+
+  state_ = token->state;
+  ConnectionState::Retain(state_);
+}
+
+Connection::Connection (const Connection& orig)
+    : state_(orig.state_)
+{
+  ConnectionState::Retain(state_);
+}
+
+Connection::~Connection ()
+{
+  ConnectionState::Release(state_);
+}
+
+Connection& Connection::operator = (const Connection& orig)
+{
+  ConnectionState::Retain(orig.state_);
+  ConnectionState::Release(state_);
+  state_ = orig.state_;
+  return *this;
+}
+
+void Connection::Disconnect ()
+{
+  if (state_ == 0) return;
+
+  // deleting the token unlinks it from the event and the trackable,
+  // and clears state_->token in Token::~Token()
+  if (state_->token) delete state_->token;
+
+  ConnectionState::Release(state_);
+  state_ = 0;
+}
+
+}  // namespace CppEvent
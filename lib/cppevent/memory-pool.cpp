@@ -0,0 +1,154 @@
+/*
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2015 Freeman Zhang <zhanggyb@gmail.com>
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use, copy,
+ * modify, merge, publish, distribute, sublicense, and/or sell copies
+ * of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+ * MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS
+ * BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN
+ * ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+
+#include <cppevent/memory-pool.hpp>
+
+#include <atomic>
+#include <new>
+
+namespace CppEvent {
+
+namespace {
+
+struct FreeBlock
+{
+  FreeBlock* next;
+};
+
+const size_t kClassCount = MemoryPool::kMaxBlockSize / MemoryPool::kGranularity;
+
+FreeBlock* free_lists[kClassCount] = { 0 };
+
+size_t live_blocks = 0;
+size_t slabs = 0;
+std::atomic<size_t> fallbacks(0);
+
+std::atomic_flag lock = ATOMIC_FLAG_INIT;
+
+class ScopedSpinLock
+{
+ public:
+
+  inline ScopedSpinLock ()
+  {
+    while (lock.test_and_set(std::memory_order_acquire)) {
+    }
+  }
+
+  inline ~ScopedSpinLock ()
+  {
+    lock.clear(std::memory_order_release);
+  }
+
+};
+
+inline size_t size_class (size_t size)
+{
+  return (size + MemoryPool::kGranularity - 1) / MemoryPool::kGranularity - 1;
+}
+
+// Cut a new slab into blocks of the given class and chain them into
+// the free list, lowest address first so consecutive allocations are
+// adjacent.
+void refill (size_t index)
+{
+  size_t block_size = (index + 1) * MemoryPool::kGranularity;
+  size_t n = MemoryPool::kSlabSize / block_size;
+  char* slab = static_cast<char*>(::operator new(MemoryPool::kSlabSize));
+
+  FreeBlock* head = free_lists[index];
+  for (size_t i = n; i > 0; i--) {
+    FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + (i - 1) * block_size);
+    block->next = head;
+    head = block;
+  }
+  free_lists[index] = head;
+  slabs++;
+}
+
+}
+
+void* MemoryPool::Allocate (size_t size)
+{
+  if (size == 0) size = 1;
+
+  if (size > kMaxBlockSize) {
+    fallbacks.fetch_add(1, std::memory_order_relaxed);
+    return ::operator new(size);
+  }
+
+  size_t index = size_class(size);
+
+  ScopedSpinLock guard;
+
+  if (free_lists[index] == 0) refill(index);
+
+  FreeBlock* block = free_lists[index];
+  free_lists[index] = block->next;
+  live_blocks++;
+
+  return block;
+}
+
+void MemoryPool::Deallocate (void* p, size_t size)
+{
+  if (p == 0) return;
+
+  if (size == 0) size = 1;
+
+  if (size > kMaxBlockSize) {
+    ::operator delete(p);
+    return;
+  }
+
+  size_t index = size_class(size);
+  FreeBlock* block = static_cast<FreeBlock*>(p);
+
+  ScopedSpinLock guard;
+
+  block->next = free_lists[index];
+  free_lists[index] = block;
+  live_blocks--;
+}
+
+size_t MemoryPool::live_count ()
+{
+  ScopedSpinLock guard;
+  return live_blocks;
+}
+
+size_t MemoryPool::slab_count ()
+{
+  ScopedSpinLock guard;
+  return slabs;
+}
+
+size_t MemoryPool::fallback_count ()
+{
+  return fallbacks.load(std::memory_order_relaxed);
+}
+
+}  // namespace CppEvent
@@ -89,7 +89,7 @@ Point AbstractFrame::GetAbsolutePosition (const AbstractView* view)
     parent = parent->super();
   }
 
-  frame = dynamic_cast<AbstractFrame*>(parent);
+  frame = frame_cast(parent);
 
   if (frame == 0)
     throw std::domain_error("The view is not added in the context");
@@ -117,7 +117,7 @@ Point AbstractFrame::GetRelativePosition (const AbstractView* view)
     parent = parent->super();
   }
 
-  frame = dynamic_cast<AbstractFrame*>(parent);
+  frame = frame_cast(parent);
 
   if (frame == 0)
     throw std::domain_error("The view is not added in the context");
@@ -153,18 +153,18 @@ void AbstractFrame::DisableViewBuffer ()
 
 AbstractFrame* AbstractFrame::GetFrame (AbstractView* view)
 {
-  if (is_frame(view)) return dynamic_cast<AbstractFrame*>(view);
+  if (is_frame(view)) return frame_cast(view);
 
   AbstractView* parent = view->super();
 
   if (parent == 0)
-    return is_frame(view) ? dynamic_cast<AbstractFrame*>(view) : 0;
+    return is_frame(view) ? frame_cast(view) : 0;
 
   while (parent && (!is_frame(parent))) {
     parent = parent->super();
   }
 
-  return dynamic_cast<AbstractFrame*>(parent);
+  return frame_cast(parent);
 }
 
 Response AbstractFrame::PerformContextMenuPress (AbstractWindow* context)
@@ -273,7 +273,7 @@ AbstractWidget* AbstractFrame::RecheckWidgetUnderCursor (AbstractWidget* orig,
   Point offset;
 
   Rect rect(
-      GetAbsolutePosition(dynamic_cast<AbstractWidget*>(orig->super())),
+      GetAbsolutePosition(widget_cast(orig->super())),
       orig->super()->size());
 
   bool cursor_in_superview = rect.contains(
@@ -312,7 +312,7 @@ AbstractWidget* AbstractFrame::RecheckWidgetUnderCursor (AbstractWidget* orig,
         parent = parent->super();
       }
 
-      result = dynamic_cast<AbstractWidget*>(parent);
+      result = widget_cast(parent);
 
       if (result) {
         result = RecursiveDispatchHoverEvent(result, context);
@@ -352,24 +352,17 @@ AbstractWidget* AbstractFrame::RecheckWidgetUnderCursor (AbstractWidget* orig,
       parent = parent->super();
     }
 
-    result = dynamic_cast<AbstractWidget*>(parent);
+    result = widget_cast(parent);
     if (result) {
 
-      for (AbstractView* p = parent->GetLastSubView(); p; p =
-               parent->GetPreviousSubView(p)) {
+      AbstractView* p = parent->FindSubWidgetAt(
+          context->local_cursor_position());
 
-        if (is_widget(p)) {
-          if (p->Contain(context->local_cursor_position())) {
-            result = dynamic_cast<AbstractWidget*>(p);
+      if (p) {
+        result = widget_cast(p);
 
-            dispatch_mouse_hover_in(result, context);
-            result = RecursiveDispatchHoverEvent(result, context);
-
-            break;
-          }
-        } else {
-          break;
-        }
+        dispatch_mouse_hover_in(result, context);
+        result = RecursiveDispatchHoverEvent(result, context);
       }
     }
 
@@ -388,21 +381,11 @@ AbstractWidget* AbstractFrame::FindWidgetUnderCursor (AbstractWindow* context)
       context->GetGlobalCursorPosition().x() - position().x() - offset.x(),
       context->GetGlobalCursorPosition().y() - position().y() - offset.y());
 
-  for (AbstractView* p = GetLastSubView(); p; p = GetPreviousSubView(p)) {
-
-    if (is_widget(p)) {
-      result = dynamic_cast<AbstractWidget*>(p);
-      if (p->Contain(context->local_cursor_position())) {
-        dispatch_mouse_hover_in(result, context);
-        break;
-      }
-    } else {
-      break;
-    }
-
-  }
+  result = widget_cast(
+      FindSubWidgetAt(context->local_cursor_position()));
 
   if (result) {
+    dispatch_mouse_hover_in(result, context);
     result = RecursiveDispatchHoverEvent(result, context);
   }
 
@@ -535,20 +518,13 @@ AbstractWidget* AbstractFrame::RecursiveDispatchHoverEvent (AbstractWidget* widg
       context->local_cursor_position().y() - widget->position().y()
       - offset.y());
 
-  for (AbstractView* p = widget->GetLastSubView(); p; p = widget->GetPreviousSubView(p)) {
-
-    if (is_widget(p)) {
-      if (p->Contain(context->local_cursor_position())) {
-        retval = dynamic_cast<AbstractWidget*>(p);
-        dispatch_mouse_hover_in(retval, context);
-        retval = RecursiveDispatchHoverEvent(retval, context);
-
-        break;
-      }
-    } else {
-      break;
-    }
+  AbstractView* p = widget->FindSubWidgetAt(
+      context->local_cursor_position());
 
+  if (p) {
+    retval = widget_cast(p);
+    dispatch_mouse_hover_in(retval, context);
+    retval = RecursiveDispatchHoverEvent(retval, context);
   }
 
   return retval;
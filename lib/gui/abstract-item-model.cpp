@@ -84,6 +84,17 @@ RefPtr<AbstractForm> ModelIndex::GetData () const
   }
 }
 
+const String& ModelIndex::GetString () const
+{
+  static const String empty;
+
+  if (node_) {
+    return node_->string;
+  } else {
+    return empty;
+  }
+}
+
 const AbstractForm* ModelIndex::GetRawData () const
 {
   if (node_) {
@@ -245,8 +256,35 @@ ModelIndex ModelIndex::GetSibling (int row, int column) const
 
 // -------------------------------
 
+void ModelTable::Rebuild (const ModelNode* parent)
+{
+  rows_ = 0;
+  columns_ = 0;
+  cells_.clear();
+
+  int columns = 0;
+  for (ModelNode* row = parent->child; row; row = row->down) {
+    columns = 0;
+    for (ModelNode* node = row; node; node = node->right) columns++;
+    if (columns > columns_) columns_ = columns;
+    rows_++;
+  }
+
+  cells_.assign(rows_ * columns_, 0);
+
+  int i = 0, j = 0;
+  for (ModelNode* row = parent->child; row; row = row->down, i++) {
+    j = 0;
+    for (ModelNode* node = row; node; node = node->right, j++) {
+      cells_[j * rows_ + i] = node;
+    }
+  }
+
+  valid_ = true;
+}
+
 AbstractItemModel::AbstractItemModel ()
-    : Object()
+    : Object(), nodes_("ModelNode", 512)
 {
 
 }
@@ -286,6 +324,12 @@ bool AbstractItemModel::SetData (const ModelIndex& index,
   return set_index_data(index, data);
 }
 
+bool AbstractItemModel::SetString (const ModelIndex& index,
+                                   const String& string)
+{
+  return set_index_string(index, string);
+}
+
 BlendInt::Font AbstractItemModel::GetFont (const ModelIndex& parent) const
 {
   return BlendInt::Font();
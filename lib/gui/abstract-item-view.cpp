@@ -21,6 +21,8 @@
  * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
  */
 
+#include <algorithm>
+
 #include <blendint/gui/abstract-item-view.hpp>
 
 namespace BlendInt {
@@ -36,4 +38,61 @@ namespace BlendInt {
 
   }
 
+  void AbstractItemView::ScrollTo (int y)
+  {
+    const RefPtr<AbstractItemModel> model = GetModel();
+    int h = GetRowHeight();
+    int max = 0;
+
+    if (model && h > 0) {
+      max = model->GetRowCount() * h - size().height();
+    }
+
+    y = std::max(0, std::min(y, max));
+
+    if (y != GetOffset().y()) {
+      set_offset(0, y);
+      fire_scrolled_event(0, y);
+      RequestRedraw();
+    }
+  }
+
+  int AbstractItemView::GetRowHeight () const
+  {
+    return 0;
+  }
+
+  int AbstractItemView::GetVisibleRows (int* first, int* y) const
+  {
+    const RefPtr<AbstractItemModel> model = GetModel();
+    int h = GetRowHeight();
+    int offset = GetOffset().y();
+
+    *first = 0;
+    *y = size().height() - h;
+
+    if (!model || h <= 0) return 0;
+
+    *first = offset / h;
+    *y = size().height() + offset - (*first + 1) * h;
+
+    // the last row whose top is still below the top edge
+    int last = std::min(model->GetRowCount() - 1,
+                        (size().height() + offset - 1) / h);
+
+    return std::max(0, last - *first + 1);
+  }
+
+  int AbstractItemView::GetRowAt (int y) const
+  {
+    const RefPtr<AbstractItemModel> model = GetModel();
+    int h = GetRowHeight();
+
+    if (!model || h <= 0 || y < 0 || y >= size().height()) return -1;
+
+    int row = (size().height() - y + GetOffset().y()) / h;
+
+    return row < model->GetRowCount() ? row : -1;
+  }
+
 }
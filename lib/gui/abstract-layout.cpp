@@ -26,19 +26,19 @@
 namespace BlendInt {
 
 AbstractLayout::AbstractLayout ()
-    : AbstractWidget()
+    : AbstractWidget(), layout_dirty_(false)
 {
 
 }
 
 AbstractLayout::AbstractLayout (int width, int height)
-    : AbstractWidget(width, height)
+    : AbstractWidget(width, height), layout_dirty_(false)
 {
 
 }
 
 AbstractLayout::AbstractLayout (int width, int height, const Margin& margin)
-    : AbstractWidget(width, height), margin_(margin)
+    : AbstractWidget(width, height), margin_(margin), layout_dirty_(false)
 {
 
 }
@@ -47,13 +47,36 @@ AbstractLayout::~AbstractLayout ()
 {
 }
 
+void AbstractLayout::RequestLayout ()
+{
+  layout_dirty_ = true;
+  RequestRedraw();
+}
+
+void AbstractLayout::FlushLayout ()
+{
+  if (!layout_dirty_) return;
+
+  // clear the flag first, Adjust() may resize sub layouts which
+  // request their own layout pass
+  layout_dirty_ = false;
+  Adjust();
+}
+
 void AbstractLayout::SetMargin (const Margin& margin)
 {
   if (margin_ == margin) return;
 
+  InvalidateSizeHint();
   PerformMarginUpdate(margin);
 }
 
+bool AbstractLayout::PreDraw (AbstractWindow* context)
+{
+  FlushLayout();
+  return AbstractWidget::PreDraw(context);
+}
+
 Response BlendInt::AbstractLayout::Draw (AbstractWindow* context)
 {
   return subview_count() ? Ignore : Finish;
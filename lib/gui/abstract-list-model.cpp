@@ -31,20 +31,22 @@ namespace BlendInt {
 AbstractListModel::AbstractListModel ()
     : AbstractItemModel(), root_(0)
 {
-  root_ = new ModelNode;
+  root_ = CreateNode();
 }
 
 AbstractListModel::~AbstractListModel ()
 {
   ClearAllChildNodes();
 
-  delete root_;
+  DestroyNode(root_);
 }
 
 bool AbstractListModel::InsertColumns (int column,
                                        int count,
                                        const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   DBG_ASSERT(count > 0);
@@ -57,10 +59,10 @@ bool AbstractListModel::InsertColumns (int column,
 
   if (node->child == 0) {	// if the node has no child, create and append 1 row with count columns
 
-    first = new ModelNode;
+    first = CreateNode();
     last = first;
     for (int i = 1; i < count; i++) {
-      last->right = new ModelNode;
+      last->right = CreateNode();
       last->right->left = last;
       last = last->right;
     }
@@ -84,10 +86,10 @@ bool AbstractListModel::InsertColumns (int column,
         column--;
       }
 
-      first = new ModelNode;
+      first = CreateNode();
       last = first;
       for (int i = 1; i < count; i++) {
-        last->right = new ModelNode;
+        last->right = CreateNode();
         last->right->left = last;
         last = last->right;
       }
@@ -148,6 +150,8 @@ bool AbstractListModel::RemoveColumns (int column,
                                        int count,
                                        const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   DBG_ASSERT(count > 0);
@@ -189,7 +193,7 @@ bool AbstractListModel::RemoveColumns (int column,
         if (tmp->right) tmp->right->left = 0;
         if (tmp->down) tmp->down->up = 0;
 
-        delete tmp;
+        DestroyNode(tmp);
 
         tmp = last;
         if (tmp == 0) break;
@@ -255,6 +259,8 @@ bool AbstractListModel::InsertRows (int row,
                                     int count,
                                     const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   DBG_ASSERT(count > 0);
@@ -265,11 +271,11 @@ bool AbstractListModel::InsertRows (int row,
   ModelNode* first = 0;
   ModelNode* last = 0;
 
-  first = new ModelNode;
+  first = CreateNode();
   last = first;
 
   for (int i = 1; i < count; i++) {
-    last->down = new ModelNode;
+    last->down = CreateNode();
     last->down->up = last;
     last = last->down;
   }
@@ -306,7 +312,7 @@ bool AbstractListModel::InsertRows (int row,
 
           while (ref_iter->right) {   // add one row
 
-            tmp2 = new ModelNode;
+            tmp2 = CreateNode();
             tmp1->right = tmp2;
             tmp2->left = tmp1;
             tmp1 = tmp2;
@@ -336,7 +342,7 @@ bool AbstractListModel::InsertRows (int row,
 
           while (ref_iter->right) {   // add one row
 
-            tmp2 = new ModelNode;
+            tmp2 = CreateNode();
             tmp1->right = tmp2;
             tmp2->left = tmp1;
             tmp1 = tmp2;
@@ -369,7 +375,7 @@ bool AbstractListModel::InsertRows (int row,
 
         while (ref_iter->right) {   // add one row
 
-          tmp2 = new ModelNode;
+          tmp2 = CreateNode();
           tmp1->right = tmp2;
           tmp2->left = tmp1;
           tmp1 = tmp2;
@@ -391,6 +397,8 @@ bool AbstractListModel::RemoveRows (int row,
                                     int count,
                                     const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   DBG_ASSERT(count > 0);
@@ -463,6 +471,13 @@ ModelIndex AbstractListModel::GetIndex (int row,
 
   if (node == 0) return index;
 
+  // top level rows are looked up in the table
+  if (parent_node == root_) {
+    if (!table_.valid()) table_.Rebuild(root_);
+    set_index_node(index, table_.cell(row, column));
+    return index;
+  }
+
   // move row down
   while (node->down && (row > 0)) {
     node = node->down;
@@ -526,13 +541,15 @@ void AbstractListModel::DestroyRow (ModelNode* node)
     }
 
     tmp = node->right;
-    delete node;
+    DestroyNode(node);
     node = tmp;
   }
 }
 
 void AbstractListModel::ClearAllChildNodes ()
 {
+  table_.Invalidate();
+
   ModelNode* node = root_->child;
 
   if (node) {
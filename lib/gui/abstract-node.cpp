@@ -101,7 +101,7 @@ namespace BlendInt {
     while (parent) {
 
       if (is_node(parent)) {
-        node = dynamic_cast<AbstractNode*>(parent);
+        node = node_cast(parent);
         break;
       }
 
@@ -218,7 +218,7 @@ namespace BlendInt {
         if (widget == 0) {
           pressed_ = true;
         } else {
-          SetFocusedWidget(dynamic_cast<AbstractWidget*>(widget), context);
+          SetFocusedWidget(widget_cast(widget), context);
         }
 
       } else {
@@ -604,7 +604,7 @@ namespace BlendInt {
           parent = parent->super();
         }
 
-        result = dynamic_cast<AbstractWidget*>(parent);
+        result = widget_cast(parent);
 
         if (result) {
           result = RecursiveDispatchHoverEvent(result, context);
@@ -644,24 +644,17 @@ namespace BlendInt {
         parent = parent->super();
       }
 
-      result = dynamic_cast<AbstractWidget*>(parent);
+      result = widget_cast(parent);
       if (result) {
 
-        for (AbstractView* p = parent->GetLastSubView(); p;
-            p = parent->GetPreviousSubView(p)) {
+        AbstractView* p = parent->FindSubWidgetAt(
+            context->local_cursor_position());
 
-          if (is_widget(p)) {
-            if (p->Contain(context->local_cursor_position())) {
-              result = dynamic_cast<AbstractWidget*>(p);
+        if (p) {
+          result = widget_cast(p);
 
-              dispatch_mouse_hover_in(result, context);
-              result = RecursiveDispatchHoverEvent(result, context);
-
-              break;
-            }
-          } else {
-            break;
-          }
+          dispatch_mouse_hover_in(result, context);
+          result = RecursiveDispatchHoverEvent(result, context);
         }
       }
 
@@ -679,21 +672,11 @@ namespace BlendInt {
         context->local_cursor_position().x() - position().x() - offset.x(),
         context->local_cursor_position().y() - position().y() - offset.y());
 
-    for (AbstractView* p = GetLastSubView(); p; p = GetPreviousSubView(p)) {
-
-      if (is_widget(p)) {
-        result = dynamic_cast<AbstractWidget*>(p);
-        if (p->Contain(context->local_cursor_position())) {
-          dispatch_mouse_hover_in(result, context);
-          break;
-        }
-      } else {
-        break;
-      }
-
-    }
+    result = widget_cast(
+        FindSubWidgetAt(context->local_cursor_position()));
 
     if (result) {
+      dispatch_mouse_hover_in(result, context);
       result = RecursiveDispatchHoverEvent(result, context);
     }
 
@@ -711,21 +694,13 @@ namespace BlendInt {
         context->local_cursor_position().y() - widget->position().y()
             - offset.y());
 
-    for (AbstractView* p = widget->GetLastSubView(); p;
-        p = widget->GetPreviousSubView(p)) {
-
-      if (is_widget(p)) {
-        if (p->Contain(context->local_cursor_position())) {
-          retval = dynamic_cast<AbstractWidget*>(p);
-          dispatch_mouse_hover_in(retval, context);
-          retval = RecursiveDispatchHoverEvent(retval, context);
-
-          break;
-        }
-      } else {
-        break;
-      }
+    AbstractView* p = widget->FindSubWidgetAt(
+        context->local_cursor_position());
 
+    if (p) {
+      retval = widget_cast(p);
+      dispatch_mouse_hover_in(retval, context);
+      retval = RecursiveDispatchHoverEvent(retval, context);
     }
 
     return retval;
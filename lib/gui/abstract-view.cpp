@@ -21,6 +21,8 @@
  * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
  */
 
+#include <algorithm>
+
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
@@ -29,12 +31,31 @@
 #include <blendint/opengl/opengl.hpp>
 
 #include <blendint/gui/abstract-view.hpp>
+#include <blendint/gui/hit-test-grid.hpp>
 #include <blendint/gui/abstract-window.hpp>
+#include <blendint/gui/abstract-frame.hpp>
+#include <blendint/gui/abstract-widget.hpp>
+#include <blendint/gui/abstract-node.hpp>
 
 #include <blendint/gui/managed-ptr.hpp>
 
 namespace BlendInt {
 
+enum SizeHintFlagMask
+{
+
+  SizeHintPreferredSizeMask = 0x1 << 0,
+
+  SizeHintExpandXCachedMask = 0x1 << 1,
+
+  SizeHintExpandYCachedMask = 0x1 << 2,
+
+  SizeHintExpandXMask = 0x1 << 3,
+
+  SizeHintExpandYMask = 0x1 << 4
+
+};
+
 bool IsContained (AbstractView* container, AbstractView* widget)
 {
   bool retval = false;
@@ -53,6 +74,14 @@ bool IsContained (AbstractView* container, AbstractView* widget)
 
 float AbstractView::kBorderWidth = 1.f;
 
+unsigned int AbstractView::kSizeHintRecomputeCount = 0;
+
+unsigned int AbstractView::kLastSizeHintRecomputeCount = 0;
+
+unsigned int AbstractView::kSkippedResizeCount = 0;
+
+unsigned int AbstractView::kDrawCount = 0;
+
 // std::mutex AbstractView::kRefreshMutex;
 
 const float AbstractView::cornervec[WIDGET_CURVE_RESOLU][2] = {
@@ -116,7 +145,13 @@ AbstractView::AbstractView ()
   previous_(0),
   next_(0),
   first_(0),
-  last_(0)
+  last_(0),
+  size_hint_flags_(0),
+  subview_index_valid_(false),
+  index_in_super_(0),
+  hit_test_grid_(0),
+  geometry_stamp_(1),
+  size_hint_follows_subviews_(false)
 {
 }
 
@@ -131,7 +166,13 @@ AbstractView::AbstractView (int width, int height)
   previous_(0),
   next_(0),
   first_(0),
-  last_(0)
+  last_(0),
+  size_hint_flags_(0),
+  subview_index_valid_(false),
+  index_in_super_(0),
+  hit_test_grid_(0),
+  geometry_stamp_(1),
+  size_hint_follows_subviews_(false)
 {
   set_size(std::abs(width), std::abs(height));
 }
@@ -152,6 +193,8 @@ AbstractView::~AbstractView ()
     DBG_ASSERT(previous_ == 0);
     DBG_ASSERT(next_ == 0);
   }
+
+  delete hit_test_grid_;
 }
 
 Point AbstractView::GetGlobalPosition () const
@@ -241,6 +284,14 @@ void AbstractView::MoveTo (const Point& pos)
 
 void AbstractView::RequestRedraw ()
 {
+#ifdef DEBUG
+  if (std::this_thread::get_id() != AbstractWindow::main_thread_id()) {
+    DBG_PRINT_MSG("Warning: %s",
+                  "RequestRedraw() called out of the main thread, use "
+                  "AbstractWindow::PostToUIThread() instead");
+  }
+#endif
+
   if (!refresh()) {
 
     AbstractView* root = this;
@@ -306,6 +357,75 @@ Size AbstractView::GetPreferredSize () const
   return Size(200, 200);
 }
 
+const Size& AbstractView::GetCachedPreferredSize () const
+{
+  if (!(size_hint_flags_ & SizeHintPreferredSizeMask)) {
+    cached_preferred_size_ = GetPreferredSize();
+    SETBIT(size_hint_flags_, SizeHintPreferredSizeMask);
+    kSizeHintRecomputeCount++;
+  }
+
+  return cached_preferred_size_;
+}
+
+bool AbstractView::IsCachedExpandX () const
+{
+  if (!(size_hint_flags_ & SizeHintExpandXCachedMask)) {
+    if (IsExpandX())
+      SETBIT(size_hint_flags_, SizeHintExpandXMask);
+    else
+      CLRBIT(size_hint_flags_, SizeHintExpandXMask);
+    SETBIT(size_hint_flags_, SizeHintExpandXCachedMask);
+    kSizeHintRecomputeCount++;
+  }
+
+  return size_hint_flags_ & SizeHintExpandXMask;
+}
+
+bool AbstractView::IsCachedExpandY () const
+{
+  if (!(size_hint_flags_ & SizeHintExpandYCachedMask)) {
+    if (IsExpandY())
+      SETBIT(size_hint_flags_, SizeHintExpandYMask);
+    else
+      CLRBIT(size_hint_flags_, SizeHintExpandYMask);
+    SETBIT(size_hint_flags_, SizeHintExpandYCachedMask);
+    kSizeHintRecomputeCount++;
+  }
+
+  return size_hint_flags_ & SizeHintExpandYMask;
+}
+
+void AbstractView::InvalidateSizeHint ()
+{
+  // superviews may have cached a size hint computed from this view,
+  // always walk up to the root
+  for (AbstractView* p = this; p; p = p->super_) {
+    p->size_hint_flags_ = 0;
+  }
+}
+
+AbstractFrame* AbstractView::frame_cast (AbstractView* view)
+{
+  if (!is_frame(view)) return 0;
+  DBG_ASSERT(dynamic_cast<AbstractFrame*>(view) == static_cast<AbstractFrame*>(view));
+  return static_cast<AbstractFrame*>(view);
+}
+
+AbstractWidget* AbstractView::widget_cast (AbstractView* view)
+{
+  if (!is_widget(view)) return 0;
+  DBG_ASSERT(dynamic_cast<AbstractWidget*>(view) == static_cast<AbstractWidget*>(view));
+  return static_cast<AbstractWidget*>(view);
+}
+
+AbstractNode* AbstractView::node_cast (AbstractView* view)
+{
+  if (!is_node(view)) return 0;
+  DBG_ASSERT(dynamic_cast<AbstractNode*>(view) == static_cast<AbstractNode*>(view));
+  return static_cast<AbstractNode*>(view);
+}
+
 bool AbstractView::Contain (const Point& point) const
 {
   if (point.x() < position_.x() || point.y() < position_.y()
@@ -424,6 +544,7 @@ void AbstractView::MoveToFirst (AbstractView* view)
     view->super_->first_->previous_ = view;
     view->super_->first_ = view;
 
+    view->super_->invalidate_subview_index();
     view->super_->RequestRedraw();
   }
 }
@@ -451,6 +572,7 @@ void AbstractView::MoveToLast (AbstractView* view)
     view->super_->last_->next_ = view;
     view->super_->last_ = view;
 
+    view->super_->invalidate_subview_index();
     view->super_->RequestRedraw();
   }
 }
@@ -490,6 +612,7 @@ void AbstractView::MoveForward (AbstractView* view)
         DBG_ASSERT(view->next_->previous_ == view);
       }
 
+      view->super_->invalidate_subview_index();
       view->super_->RequestRedraw();
 
     } else {
@@ -537,6 +660,7 @@ void AbstractView::MoveBackward (AbstractView* view)
         DBG_ASSERT(view->next_->previous_ == view);
       }
 
+      view->super_->invalidate_subview_index();
       view->super_->RequestRedraw();
 
     } else {
@@ -551,6 +675,12 @@ void AbstractView::SetDefaultBorderWidth (float border)
   kBorderWidth = border;
 }
 
+void AbstractView::ResetSizeHintStats ()
+{
+  kLastSizeHintRecomputeCount = kSizeHintRecomputeCount;
+  kSizeHintRecomputeCount = 0;
+}
+
 int AbstractView::GetOutlineVertices (int round_type)
 {
   round_type = round_type & RoundAll;
@@ -580,18 +710,19 @@ void AbstractView::DrawSubViewsOnce (AbstractWindow* context)
 {
   //bool refresh_record = false;
 
-  for (ManagedPtr p = GetFirstSubView(); p; ++p) {
+  for (BorrowedPtr p = GetFirstSubView(); p; ++p) {
 
     set_refresh(false);
     
     if (p->PreDraw(context)) {
 
       Response response = p->Draw(context);
+      kDrawCount++;
 
       p->set_refresh(refresh());
 
       if (response == Ignore) {
-        for (ManagedPtr sub = p->GetFirstSubView(); sub; ++sub) {
+        for (BorrowedPtr sub = p->GetFirstSubView(); sub; ++sub) {
           DispatchDrawEvent(sub.get(), context);
         }
       }
@@ -722,6 +853,16 @@ bool AbstractView::SwapIndex (AbstractView *view1, AbstractView *view2)
 
   }
 
+  AbstractView* super = view1->super_;
+  if (super->subview_index_valid_) {
+    std::swap(super->subview_index_[view1->index_in_super_],
+              super->subview_index_[view2->index_in_super_]);
+    std::swap(view1->index_in_super_, view2->index_in_super_);
+  }
+  super->geometry_stamp_++;
+
+  super->InvalidateSizeHint();
+
   return true;
 }
 
@@ -765,6 +906,7 @@ bool AbstractView::InsertSiblingBefore (AbstractView *src, AbstractView *dst)
         dst->super_->first_ = dst;
       }
 
+      dst->super_->invalidate_subview_index();
       return true;
 
     } else {
@@ -791,6 +933,8 @@ bool AbstractView::InsertSiblingBefore (AbstractView *src, AbstractView *dst)
 
   dst->super_ = src->super_;
   src->super_->subview_count_++;
+  src->super_->invalidate_subview_index();
+  src->super_->InvalidateSizeHint();
 
   return true;
 }
@@ -835,6 +979,7 @@ bool AbstractView::InsertSiblingAfter (AbstractView *src, AbstractView *dst)
         dst->super_->last_ = dst;
       }
 
+      dst->super_->invalidate_subview_index();
       return true;
 
     } else {
@@ -861,6 +1006,8 @@ bool AbstractView::InsertSiblingAfter (AbstractView *src, AbstractView *dst)
 
   dst->super_ = src->super_;
   src->super_->subview_count_++;
+  src->super_->invalidate_subview_index();
+  src->super_->InvalidateSizeHint();
 
   return true;
 }
@@ -873,11 +1020,12 @@ void AbstractView::DispatchDrawEvent (AbstractView* view,
   if (view->PreDraw(context)) {
 
     Response response = view->Draw(context);
+    kDrawCount++;
 
     view->set_refresh(view->super_->refresh());
 
     if (response == Ignore) {
-      for (ManagedPtr sub = view->GetFirstSubView(); sub; ++sub) {
+      for (BorrowedPtr sub = view->GetFirstSubView(); sub; ++sub) {
         DispatchDrawEvent(sub.get(), context);
       }
     }
@@ -2017,28 +2165,54 @@ AbstractView* AbstractView::GetSubViewAt (int i) const
 {
   if ((i < 0) || (i >= subview_count_)) return 0;
 
-  AbstractView* widget = 0;
+  if (!subview_index_valid_) BuildSubViewIndex();
 
-  if (i < ((subview_count_ + 1) / 2)) {
+  return subview_index_[i];
+}
 
-    widget = first_;
-    while (i > 0) {
-      widget = widget->next_;
-      i--;
-    }
+int AbstractView::GetSubViewIndex (const AbstractView* view) const
+{
+  if ((view == 0) || (view->super_ != this)) return -1;
 
-  } else {
+  if (!subview_index_valid_) BuildSubViewIndex();
+
+  return view->index_in_super_;
+}
 
-    widget = last_;
-    int max = subview_count_ - 1;
-    while (i < max) {
-      widget = widget->previous_;
-      i++;
+AbstractView* AbstractView::FindSubWidgetAt (const Point& point) const
+{
+  if (subview_count_ >= kHitTestGridThreshold) {
+
+    if (hit_test_grid_ == 0) hit_test_grid_ = new HitTestGrid;
+
+    if (hit_test_grid_->stamp() != geometry_stamp_) {
+      hit_test_grid_->Build(this, geometry_stamp_);
     }
 
+    return hit_test_grid_->Find(point);
+  }
+
+  for (AbstractView* p = GetLastSubView(); p; p = GetPreviousSubView(p)) {
+    if (!is_widget(p)) break;
+    if (p->Contain(point)) return p;
+  }
+
+  return 0;
+}
+
+void AbstractView::BuildSubViewIndex () const
+{
+  subview_index_.clear();
+  subview_index_.reserve(subview_count_);
+
+  int i = 0;
+  for (AbstractView* p = first_; p; p = p->next_, i++) {
+    p->index_in_super_ = i;
+    subview_index_.push_back(p);
   }
 
-  return widget;
+  DBG_ASSERT(i == subview_count_);
+  subview_index_valid_ = true;
 }
 
 AbstractView* AbstractView::PushFrontSubView (AbstractView* view)
@@ -2075,6 +2249,8 @@ AbstractView* AbstractView::PushFrontSubView (AbstractView* view)
   view->previous_ = 0;
   view->super_ = this;
   subview_count_++;
+  invalidate_subview_index();
+  InvalidateSizeHint();
 
   view->PerformAfterAdded();
 
@@ -2112,18 +2288,11 @@ AbstractView* AbstractView::InsertSubView (int index, AbstractView* view)
 
   } else {
 
-    AbstractView* p = first_;
-
     if (index > 0) {
 
-      while (p && (index > 0)) {
-        if (p->next_ == 0) break;
-
-        p = p->next_;
-        index--;
-      }
+      if (index < subview_count_) {	// insert
 
-      if (index == 0) {	// insert
+        AbstractView* p = GetSubViewAt(index);
 
         view->previous_ = p->previous_;
         view->next_ = p;
@@ -2132,7 +2301,6 @@ AbstractView* AbstractView::InsertSubView (int index, AbstractView* view)
 
       } else {	// same as push back
 
-        DBG_ASSERT(p == last_);
         last_->next_ = view;
         view->previous_ = last_;
         last_ = view;
@@ -2153,6 +2321,8 @@ AbstractView* AbstractView::InsertSubView (int index, AbstractView* view)
 
   view->super_ = this;
   subview_count_++;
+  invalidate_subview_index();
+  InvalidateSizeHint();
 
   view->PerformAfterAdded();
 
@@ -2193,6 +2363,12 @@ AbstractView* AbstractView::PushBackSubView (AbstractView* view)
   view->next_ = 0;
   view->super_ = this;
   subview_count_++;
+  if (subview_index_valid_) {
+    view->index_in_super_ = subview_count_ - 1;
+    subview_index_.push_back(view);
+  }
+  geometry_stamp_++;
+  InvalidateSizeHint();
 
   view->PerformAfterAdded();
   DBG_ASSERT(view->super_ == this);
@@ -2224,6 +2400,13 @@ AbstractView* AbstractView::RemoveSubView (AbstractView* view)
 
   subview_count_--;
   DBG_ASSERT(subview_count_ >= 0);
+  if (subview_index_valid_ && (view->index_in_super_ == subview_count_)) {
+    subview_index_.pop_back();
+    geometry_stamp_++;
+  } else {
+    invalidate_subview_index();
+  }
+  InvalidateSizeHint();
 
   view->previous_ = 0;
   view->next_ = 0;
@@ -2264,6 +2447,10 @@ void AbstractView::ClearSubViews ()
   subview_count_ = 0;
   first_ = 0;
   last_ = 0;
+
+  subview_index_.clear();
+  invalidate_subview_index();
+  InvalidateSizeHint();
 }
 
 void AbstractView::ResizeSubView (AbstractView* sub, int width, int height)
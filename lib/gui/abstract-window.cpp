@@ -22,6 +22,7 @@
  */
 
 #include <stdexcept>
+#include <future>
 
 #include <glm/gtc/type_ptr.hpp>
 #include <glm/gtx/transform.hpp>
@@ -40,13 +41,56 @@
 
 namespace BlendInt {
 
+namespace {
+
+class UIDispatcher: public CppEvent::AbstractDispatcher
+{
+ public:
+
+  UIDispatcher ()
+      : CppEvent::AbstractDispatcher()
+  {
+  }
+
+  virtual ~UIDispatcher ()
+  {
+  }
+
+  static const int kCapacity = 4096;
+
+ protected:
+
+  virtual bool Post (const std::function<void()>& task) final
+  {
+    if (AbstractWindow::ui_task_depth() >= kCapacity) return false;
+
+    AbstractWindow::PostToUIThread(task);
+    return true;
+  }
+
+};
+
+}
+
 std::thread::id AbstractWindow::kMainThreadID;
 
 Theme* AbstractWindow::kTheme = 0;
 Icons* AbstractWindow::kIcons = 0;
+
+FrameScheduler AbstractWindow::kFrameScheduler;
+
+std::atomic<void (*) ()> AbstractWindow::kWakeupHandler(nullptr);
 Shaders* AbstractWindow::kShaders = 0;
 
-AbstractWindow* AbstractWindow::kMainWindow = 0;
+unsigned int AbstractWindow::kMergedMouseMoveCount = 0;
+
+MPSCQueue<AbstractWindow::UITask> AbstractWindow::kUITasks;
+
+std::atomic<int> AbstractWindow::kUITaskDepth(0);
+
+double AbstractWindow::kUITaskLatency = 0.0;
+
+std::atomic<AbstractWindow*> AbstractWindow::kMainWindow(nullptr);
 
 glm::mat4 AbstractWindow::default_view_matrix = glm::lookAt(
     glm::vec3(0.f, 0.f, 1.f), // eye
@@ -63,14 +107,20 @@ AbstractWindow::AbstractWindow (int flags)
   floating_frame_count_(0),
   pressed_(false),
   mouse_tracking_(false),
-  overlap_(false)
+  cursor_sampling_(false),
+  overlap_(false),
+  input_handled_(false),
+  input_latency_(0.0),
+  input_recorder_(0),
+  input_replayer_(0)
 {
   set_view_type(ViewTypeWindow);
 
   set_size(640, 480);
   set_refresh(true);
 
-  if (kMainWindow == 0) kMainWindow = this;
+  AbstractWindow* none = nullptr;
+  kMainWindow.compare_exchange_strong(none, this);
 }
 
 AbstractWindow::AbstractWindow (int width, int height, int flags)
@@ -82,18 +132,25 @@ AbstractWindow::AbstractWindow (int width, int height, int flags)
   floating_frame_count_(0),
   pressed_(false),
   mouse_tracking_(false),
-  overlap_(false)
+  cursor_sampling_(false),
+  overlap_(false),
+  input_handled_(false),
+  input_latency_(0.0),
+  input_recorder_(0),
+  input_replayer_(0)
 {
   set_view_type(ViewTypeWindow);
 
   set_refresh(true);
 
-  if (kMainWindow == 0) kMainWindow = this;
+  AbstractWindow* none = nullptr;
+  kMainWindow.compare_exchange_strong(none, this);
 }
 
 AbstractWindow::~AbstractWindow ()
 {
-  if (kMainWindow == this) kMainWindow = 0;
+  AbstractWindow* self = this;
+  kMainWindow.compare_exchange_strong(self, nullptr);
 
   if (subview_count() > 0) {
     ClearSubViews();
@@ -147,7 +204,7 @@ AbstractFrame* AbstractWindow::AddFrame (AbstractFrame* frame)
     } else {
 
       AbstractFrame* top_normal_frame =
-          dynamic_cast<AbstractFrame*>(GetSubViewAt(index));
+          frame_cast(GetSubViewAt(index));
       if (InsertSiblingAfter(top_normal_frame, frame)) {
         if (frame->focusable()) {
           if (focused_frame_ != nullptr) focused_frame_->PerformFocusOff(this);
@@ -199,7 +256,7 @@ bool AbstractWindow::SetFocusedFrame (AbstractFrame *frame)
       return false;
     }
 
-    frame = dynamic_cast<AbstractFrame*>(root_frame);
+    frame = frame_cast(root_frame);
     if (frame == nullptr) return false;
   }
 
@@ -223,7 +280,7 @@ bool AbstractWindow::SetFocusedFrame (AbstractFrame *frame)
 
   if (index < 0) return false;	// no normal frame
 
-  AbstractFrame* top_regular_frame = dynamic_cast<AbstractFrame*>(GetSubViewAt(
+  AbstractFrame* top_regular_frame = frame_cast(GetSubViewAt(
       index));
 
   if (top_regular_frame == frame) {
@@ -338,7 +395,7 @@ Point AbstractWindow::GetAbsolutePosition (const AbstractView* widget)
 
   AbstractView* p = widget->super();
   while (p && (p != this)) {
-    frame = dynamic_cast<AbstractFrame*>(p);
+    frame = frame_cast(p);
     if (frame) break;
 
     pos = pos + p->position() + p->GetOffset();
@@ -361,7 +418,7 @@ Point AbstractWindow::GetRelativePosition (const AbstractView* widget)
   AbstractView* p = widget->super();
   while (p && (p != this)) {
 
-    frame = dynamic_cast<AbstractFrame*>(p);
+    frame = frame_cast(p);
     if (frame) break;
 
     pos = pos + p->position() + p->GetOffset();
@@ -467,9 +524,10 @@ bool AbstractWindow::PreDraw (AbstractWindow* context)
 
 Response AbstractWindow::Draw (AbstractWindow* context)
 {
-  for (ManagedPtr p = first(); p; ++p) {
+  for (BorrowedPtr p = first(); p; ++p) {
     p->PreDraw(context);
     p->Draw(context);
+    count_draw();
     p->set_refresh(this->refresh());
     p->PostDraw(context);
   }
@@ -579,7 +637,7 @@ Response AbstractWindow::PerformMouseMove (AbstractWindow* context)
 
 AbstractView* AbstractWindow::RemoveSubView (AbstractView* view)
 {
-  AbstractFrame* frame = dynamic_cast<AbstractFrame*>(view);
+  AbstractFrame* frame = frame_cast(view);
   if (frame->floating()) {
     floating_frame_count_--;
     DBG_ASSERT(floating_frame_count_ >= 0);
@@ -588,11 +646,11 @@ AbstractView* AbstractWindow::RemoveSubView (AbstractView* view)
   if (frame == focused_frame_) {
 
     AbstractView* prev = frame->previous_;
-    AbstractFrame* previous_frame = dynamic_cast<AbstractFrame*>(prev);
+    AbstractFrame* previous_frame = frame_cast(prev);
 
     while ((prev != nullptr) && (!previous_frame->focusable())) {
       prev = prev->previous_;
-      previous_frame = dynamic_cast<AbstractFrame*>(prev);
+      previous_frame = frame_cast(prev);
     }
 
     focused_frame_ = previous_frame;
@@ -732,23 +790,222 @@ void AbstractWindow::GetGLSLVersion (int* major, int* minor)
 
 void AbstractWindow::DispatchMouseHover ()
 {
-  try {
+  active_frame_ = 0;
+  overlap_ = false;
 
-    active_frame_ = 0;
-    overlap_ = false;
-    
-    Response response = Ignore;
-    for (ManagedPtr p = last(); p; --p) {
-      response = dynamic_cast<AbstractFrame*>(p.get())->PerformMouseHover(this);
-      if (response == Finish) break;
+  AbstractFrame* frame = 0;
+  Response response = Ignore;
+  for (ManagedPtr p = last(); p; --p) {
+
+    frame = frame_cast(p.get());
+    if (frame == 0) {
+      DBG_PRINT_MSG("Error: %s", "Only AbstractFrame should be added in window");
+      exit(EXIT_FAILURE);
     }
 
-  } catch (std::bad_cast& e) {
+    response = frame->PerformMouseHover(this);
+    if (response == Finish) break;
+  }
+}
+
+void AbstractWindow::PostToUIThread (const std::function<void()>& task)
+{
+  UITask item;
+  item.task = task;
+  item.posted = std::chrono::steady_clock::now();
+
+  kUITasks.Push(item);
+  kUITaskDepth++;
+
+  // wake up the event loop without touching a window, which may be
+  // destroyed in the main thread meanwhile, requests are coalesced
+  // until the loop goes idle
+  if (kFrameScheduler.RequestFrame()) {
+    void (*wakeup) () = kWakeupHandler.load();
+    if (wakeup) wakeup();
+  }
+}
+
+void AbstractWindow::InvokeOnUIThread (const std::function<void()>& task)
+{
+  if (std::this_thread::get_id() == kMainThreadID) {
+    task();
+    return;
+  }
+
+  std::promise<void> done;
+  std::future<void> result = done.get_future();
+
+  PostToUIThread([&task, &done] () {
+    task();
+    done.set_value();
+  });
+
+  result.wait();
+}
+
+CppEvent::AbstractDispatcher* AbstractWindow::ui_dispatcher ()
+{
+  static UIDispatcher dispatcher;
+  return &dispatcher;
+}
+
+void AbstractWindow::ProcessUITasks ()
+{
+  int count = kUITaskDepth.load();
+  if (count <= 0) return;
+
+  std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+  double latency = 0.0;
+  UITask item;
+
+  while ((count > 0) && kUITasks.Pop(&item)) {
+    count--;
+    kUITaskDepth--;
+
+    double wait = std::chrono::duration<double, std::milli>(
+        now - item.posted).count();
+    if (wait > latency) latency = wait;
+
+    item.task();
+  }
+
+  kUITaskLatency = latency;
+}
+
+void AbstractWindow::PostInputEvent (const InputEvent& event)
+{
+  // the live input would break a replay
+  if (replaying()) return;
+
+  input_queue_.push_back(event);
+}
+
+bool AbstractWindow::replaying () const
+{
+  return input_replayer_ && (!input_replayer_->finished());
+}
+
+void AbstractWindow::ProcessInputEvents ()
+{
+  // live input is dropped while replaying, so everything in the queue
+  // is replayed once a batch was fed
+  bool replayed = input_replayer_ && (input_replayer_->Feed(input_queue_) > 0);
+
+  if (input_queue_.empty()) return;
 
-    DBG_PRINT_MSG("Error: %s", "Only AbstractFrame should be added in window");
-    exit(EXIT_FAILURE);
+  // events posted while dispatching are processed in the next frame
+  std::deque<InputEvent> events;
+  events.swap(input_queue_);
+
+  if (input_recorder_) input_recorder_->Record(events);
+
+  size_t last_size_event = events.size();
+  for (size_t i = 0; i < events.size(); i++) {
+    if (events[i].type == InputEventSize) last_size_event = i;
+  }
 
+  if (!input_handled_) {
+    oldest_input_ = events.front().timestamp;
+    input_handled_ = true;
   }
+
+  for (size_t i = 0; i < events.size(); i++) {
+
+    const InputEvent& event = events[i];
+
+    switch (event.type) {
+
+      case InputEventKey: {
+        current_input_.key = event.key;
+        current_input_.scancode = event.scancode;
+        current_input_.key_action = event.key_action;
+        current_input_.modifiers = event.modifiers;
+        current_text_.clear();
+
+        if (event.key_action == KeyPress) PerformKeyPress(this);
+        break;
+      }
+
+      case InputEventChar: {
+        current_text_.clear();
+        current_text_.push_back(event.character);
+
+        // a character follows the key event which produced it
+        if (current_input_.key_action == KeyPress) PerformKeyPress(this);
+        break;
+      }
+
+      case InputEventMouseButton: {
+        current_input_.mouse_action = event.mouse_action;
+        current_input_.mouse_button = event.mouse_button;
+        current_input_.modifiers = event.modifiers;
+
+        if (event.mouse_action == MousePress) {
+          DispatchMouseHover();
+          PerformMousePress(this);
+        } else if (event.mouse_action == MouseRelease) {
+          PerformMouseRelease(this);
+          DispatchMouseHover();
+        }
+        break;
+      }
+
+      case InputEventCursor: {
+        push_cursor_sample(event.cursor);
+
+        if (((i + 1) < events.size())
+            && (events[i + 1].type == InputEventCursor)) {
+          kMergedMouseMoveCount++;
+          break;
+        }
+
+        current_input_.cursor = event.cursor;
+        current_input_.mouse_action = MouseMove;
+        current_input_.mouse_button = MouseButtonNone;
+
+        DispatchMouseHover();
+        PerformMouseMove(this);
+        clear_cursor_samples();
+        break;
+      }
+
+      case InputEventSize: {
+        if (i != last_size_event) {
+          count_skipped_resize();
+          break;
+        }
+
+        // a replayed size also resizes the native window (source is
+        // this), so the replay draws at the recorded framebuffer size
+        PerformSizeUpdate(replayed ? this : 0, this, event.size.width(),
+                          event.size.height());
+        break;
+      }
+
+      case InputEventPosition: {
+        PerformPositionUpdate(0, this, event.position.x(),
+                              event.position.y());
+        break;
+      }
+
+      default:
+        break;
+    }
+
+  }
+}
+
+void AbstractWindow::FinishInputFrame (bool presented)
+{
+  if (input_handled_ && presented) {
+    input_latency_ = std::chrono::duration<double, std::milli>(
+        InputEvent::Clock::now() - oldest_input_).count();
+  }
+
+  input_handled_ = false;
+
+  if (input_replayer_) input_replayer_->EndFrame(presented);
 }
 
 }
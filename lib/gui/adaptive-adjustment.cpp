@@ -53,9 +53,9 @@ namespace BlendInt {
 
 		for(AbstractView* p = view()->GetFirstSubView(); p; p = view()->GetNextSubView(p)) {
 
-			tmp = p->GetPreferredSize();
+			tmp = p->GetCachedPreferredSize();
 
-			if(p->IsExpandY()) {
+			if(p->IsCachedExpandY()) {
 			  resize(p, tmp.width(), h);
 			} else {
 	      resize(p, tmp.width(), std::min(h, tmp.height()));
@@ -83,9 +83,9 @@ namespace BlendInt {
 		y += h;
 		for(AbstractView* p = view()->GetFirstSubView(); p; p = view()->GetNextSubView(p)) {
 
-			tmp = p->GetPreferredSize();
+			tmp = p->GetCachedPreferredSize();
 
-			if(p->IsExpandX()) {
+			if(p->IsCachedExpandX()) {
 			  resize(p, w, tmp.height());
 			} else {
 			  resize(p, std::min(w, tmp.width()), tmp.height());
@@ -55,8 +55,7 @@ AdaptiveLayout::~AdaptiveLayout ()
 AbstractWidget* AdaptiveLayout::AddWidget (AbstractWidget* widget)
 {
   if (PushBackSubView(widget)) {
-    Adjust();
-    RequestRedraw();
+    RequestLayout();
     return widget;
   }
 
@@ -66,8 +65,7 @@ AbstractWidget* AdaptiveLayout::AddWidget (AbstractWidget* widget)
 AbstractWidget* AdaptiveLayout::InsertWidget (int index, AbstractWidget* widget)
 {
   if (InsertSubView(index, widget)) {
-    Adjust();
-    RequestRedraw();
+    RequestLayout();
     return widget;
   }
 
@@ -86,8 +84,7 @@ AbstractWidget* AdaptiveLayout::InsertWidget (int row,
     }
 
     if (InsertSubView(column, widget)) {
-      Adjust();
-      RequestRedraw();
+      RequestLayout();
       return widget;
     }
 
@@ -99,8 +96,7 @@ AbstractWidget* AdaptiveLayout::InsertWidget (int row,
     }
 
     if (InsertSubView(row, widget)) {
-      Adjust();
-      RequestRedraw();
+      RequestLayout();
       return widget;
     }
 
@@ -134,7 +130,7 @@ Size AdaptiveLayout::GetPreferredSize () const
   if (orientation_ == Horizontal) {
     w = -space_;
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
 
       w += (tmp.width() + space_);
       h = std::max(h, tmp.height());
@@ -143,7 +139,7 @@ Size AdaptiveLayout::GetPreferredSize () const
   } else {
     h = -space_;
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
 
       w = std::max(w, tmp.width());
       h += (tmp.height() + space_);
@@ -161,7 +157,7 @@ bool AdaptiveLayout::IsExpandX () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       expand = true;
       break;
     }
@@ -175,7 +171,7 @@ bool AdaptiveLayout::IsExpandY () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       expand = true;
       break;
     }
@@ -205,8 +201,7 @@ void AdaptiveLayout::PerformMarginUpdate (const Margin& margin)
   set_margin(margin);
 
   if (subview_count()) {
-    Adjust();
-    RequestRedraw();
+    RequestLayout();
   }
 }
 
@@ -217,14 +212,14 @@ void AdaptiveLayout::PerformSizeUpdate (const AbstractView* source,
 {
   if (target == this) {
     set_size(width, height);
-    Adjust();
+    RequestLayout();
   }
 
   if (source == this) {
     report_size_update(source, target, width, height);
   } else if (source->super() == this) {
     // a sub view resized
-    Adjust();
+    RequestLayout();
   }
 }
 
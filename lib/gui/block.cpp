@@ -90,7 +90,7 @@ bool Block::IsExpandX () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       expand = true;
       break;
     }
@@ -104,7 +104,7 @@ bool Block::IsExpandY () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       expand = true;
       break;
     }
@@ -134,7 +134,7 @@ Size Block::GetPreferredSize () const
 
     for (AbstractView* p = first(); p; p = next(p)) {
       sum++;
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
 
       max_width = std::max(max_width, tmp.width());
       max_height = std::max(max_height, tmp.height());
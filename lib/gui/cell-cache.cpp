@@ -0,0 +1,113 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <utility>
+
+#include <blendint/gui/cell-cache.hpp>
+
+namespace BlendInt {
+
+  CellCache::CellCache (size_t capacity)
+  : capacity_(capacity),
+    victim_(0),
+    stamp_(0),
+    hit_count_(0),
+    miss_count_(0),
+    recycle_count_(0)
+  {
+    entries_.reserve(capacity_);
+  }
+
+  CellCache::~CellCache ()
+  {
+  }
+
+  const Text* CellCache::Get (int row, int column, const String& value)
+  {
+    uint64_t key = make_key(row, column);
+
+    std::unordered_map<uint64_t, size_t>::iterator it = lookup_.find(key);
+    if (it != lookup_.end()) {
+      Entry& entry = entries_[it->second];
+      if (entry.text->text() != value) entry.text->SetText(value);
+      entry.stamp = stamp_;
+      hit_count_++;
+      return entry.text.get();
+    }
+
+    miss_count_++;
+
+    // look for a Text not drawn in this frame, round robin
+    if (entries_.size() >= capacity_) {
+
+      size_t n = entries_.size();
+      for (size_t i = 0; i < n; i++) {
+
+        size_t index = (victim_ + i) % n;
+        Entry& entry = entries_[index];
+
+        if (entry.stamp != stamp_) {
+          lookup_.erase(entry.key);
+          entry.key = key;
+          entry.stamp = stamp_;
+          if (entry.text->text() != value) entry.text->SetText(value);
+          lookup_[key] = index;
+          victim_ = (index + 1) % n;
+          recycle_count_++;
+          return entry.text.get();
+        }
+
+      }
+
+    }
+
+    // all in use this frame: the viewport needs more cells than the
+    // capacity, grow
+    Entry entry;
+    entry.text.reset(new Text(value));
+    entry.text->SetFont(font_);
+    entry.key = key;
+    entry.stamp = stamp_;
+
+    lookup_[key] = entries_.size();
+    entries_.push_back(std::move(entry));
+
+    return entries_.back().text.get();
+  }
+
+  void CellCache::SetFont (const Font& font)
+  {
+    if (font_ == font) return;
+
+    font_ = font;
+    Clear();
+  }
+
+  void CellCache::Clear ()
+  {
+    entries_.clear();
+    lookup_.clear();
+    victim_ = 0;
+  }
+
+}
@@ -54,6 +54,7 @@ bool ComboListModel::InsertColumns (int column,
     if (rows_ == 0) rows_++;
 
     columns_ += count;
+    changed_.Invoke();
     return true;
   }
 
@@ -71,6 +72,7 @@ bool ComboListModel::RemoveColumns (int column,
       columns_ = 0;
     }
 
+    changed_.Invoke();
     return true;
   }
 
@@ -82,6 +84,7 @@ bool ComboListModel::InsertRows (int row, int count, const ModelIndex& parent)
   if (AbstractListModel::InsertRows(row, count, parent)) {
     if (columns_ == 0) columns_++;
     rows_ += count;
+    changed_.Invoke();
     return true;
   }
 
@@ -96,6 +99,7 @@ bool ComboListModel::RemoveRows (int row, int count, const ModelIndex& parent)
       rows_ = 0;
       columns_ = 0;
     }
+    changed_.Invoke();
     return true;
   }
 
@@ -147,6 +151,8 @@ void ComboListModel::SetIcon (const ModelIndex& index,
         max_icon_size_.set_height(
             std::max(max_icon_size_.height(), icon->size().height()));
       }
+
+      changed_.Invoke();
     }
   }
 }
@@ -165,6 +171,8 @@ void ComboListModel::SetText (const ModelIndex& index, const RefPtr<Text>& text)
         max_text_size_.set_height(
             std::max(max_text_size_.height(), text->size().height()));
       }
+
+      changed_.Invoke();
     }
   }
 }
@@ -176,18 +184,14 @@ ComboListView::ComboListView ()
 {
   set_size(240, 320);
 
-  GLfloat h = (GLfloat) Font::default_height();
-  GLfloat verts[] = { 0.f, 0.f, (GLfloat) size().width(), 0.f, 0.f, h,
-      (GLfloat) size().width(), h };
-
   std::vector<GLfloat> inner_verts;
 
   GenerateVertices(size(), 0.f, RoundNone, 0.f, &inner_verts, 0);
   vbo_.generate();
 
-  glGenVertexArrays(2, vao_);
+  glGenVertexArrays(1, &vao_);
 
-  glBindVertexArray(vao_[0]);
+  glBindVertexArray(vao_);
 
   vbo_.bind(0);
   vbo_.set_data(sizeof(GLfloat) * inner_verts.size(), &inner_verts[0]);
@@ -195,21 +199,13 @@ ComboListView::ComboListView ()
   glEnableVertexAttribArray(AttributeCoord);
   glVertexAttribPointer(AttributeCoord, 3, GL_FLOAT, GL_FALSE, 0, 0);
 
-  glBindVertexArray(vao_[1]);
-
-  vbo_.bind(1);
-  vbo_.set_data(sizeof(verts), verts);
-
-  glEnableVertexAttribArray(AttributeCoord);
-  glVertexAttribPointer(AttributeCoord, 2, GL_FLOAT, GL_FALSE, 0, 0);
-
   glBindVertexArray(0);
   vbo_.reset();
 }
 
 ComboListView::~ComboListView ()
 {
-  glDeleteVertexArrays(2, vao_);
+  glDeleteVertexArrays(1, &vao_);
 }
 
 bool ComboListView::IsExpandX () const
@@ -276,7 +272,6 @@ ModelIndex ComboListView::GetIndexAt (const Point& point) const
 
 Response ComboListView::Draw (AbstractWindow* context)
 {
-  // int y = size().height();
   const int h = Font::default_height();
 
   AbstractWindow::shaders()->widget_inner_program()->use();
@@ -289,54 +284,13 @@ Response ComboListView::Draw (AbstractWindow* context)
   glUniform4fv(AbstractWindow::shaders()->location(Shaders::WIDGET_INNER_COLOR),
                1, AbstractWindow::theme()->regular().inner.data());
 
-  glBindVertexArray(vao_[0]);
+  glBindVertexArray(vao_);
   // glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
 
   context->BeginPushStencil();  // inner stencil
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
   context->EndPushStencil();
 
-  /*
-  AbstractWindow::shaders()->widget_triangle_program()->use();
-
-  glUniform1i(
-      AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA), 0);
-  glUniform1i(
-      AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_ANTI_ALIAS),
-      0);
-  glVertexAttrib4f(AttributeColor, 0.475f, 0.475f, 0.475f, 0.75f);
-
-  glBindVertexArray(vao_[1]);
-
-  int i = 0;
-  while (y > 0) {
-    y -= h;
-
-    glUniform2f(
-        AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_POSITION),
-        0, y);
-
-    if (i == highlight_index_) { // TODO: use different functions for performance
-      glUniform1i(
-          AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA),
-          -35);
-    } else {
-      if (i % 2 == 0) {
-        glUniform1i(
-            AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA),
-            0);
-      } else {
-        glUniform1i(
-            AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA),
-            15);
-      }
-    }
-
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    i++;
-  }
-  */
-
   if (model_) {
 
     ModelIndex index = model_->GetRootIndex();
@@ -347,7 +301,7 @@ Response ComboListView::Draw (AbstractWindow* context)
 
     while (index.valid()) {
 
-      index.GetData()->DrawInRect(
+      index.GetRawData()->DrawInRect(
           rect, AlignCenter | AlignJustify | AlignBaseline,
           AbstractWindow::theme()->menu_back().text.data());
 
@@ -356,7 +310,7 @@ Response ComboListView::Draw (AbstractWindow* context)
 
         rect.set_width(size().width() - pixel_size(kPaddingLeft + kPaddingRight) - h);
         rect.set_x(rect.x() + h);
-        next.GetData()->DrawInRect(
+        next.GetRawData()->DrawInRect(
             rect, AlignRight | AlignJustify | AlignBaseline,
             AbstractWindow::theme()->menu_back().text.data());
         next = next.GetRightIndex();
@@ -373,7 +327,7 @@ Response ComboListView::Draw (AbstractWindow* context)
   AbstractWindow::shaders()->widget_inner_program()->use();
 
   context->BeginPopStencil(); // pop inner stencil
-  glBindVertexArray(vao_[0]);
+  glBindVertexArray(vao_);
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
   glBindVertexArray(0);
   context->EndPopStencil();
@@ -390,13 +344,6 @@ void ComboListView::PerformSizeUpdate (const AbstractView* source,
 
     set_size(width, height);
 
-    GLfloat h = Font::default_height();
-    GLfloat verts[] = { 0.f, 0.f, (GLfloat) width, 0.f, 0.f, h, (GLfloat) width,
-        h };
-
-    vbo_.bind(1);
-    vbo_.set_data(sizeof(verts), verts);
-
     std::vector<GLfloat> inner_verts;
     GenerateVertices(size(), 0.f, RoundNone, 0.f, &inner_verts, 0);
 
@@ -433,11 +380,7 @@ Response ComboListView::PerformMousePress (AbstractWindow* context)
       i = i / h;
       highlight_index_ = i;
 
-      index = model_->GetRootIndex().GetChildIndex();
-      while ((i > 0) && index.valid()) {
-        index = index.GetDownIndex();
-        i--;
-      }
+      index = model_->GetIndex(i, 0, model_->GetRootIndex());
 
       if (!index.valid()) {
         highlight_index_ = -1;
@@ -548,13 +491,19 @@ Size ComboBox::GetPreferredSize () const
 void ComboBox::SetModel (const RefPtr<ComboListModel>& model)
 {
   if (model_) {
+    model_->changed().disconnect(this, &ComboBox::OnModelChanged);
     model_ = model;
+    InvalidateSizeHint();
     RequestRedraw();
   } else if (model) {
     model_ = model;
+    InvalidateSizeHint();
     RequestRedraw();
   }
 
+  // the preferred size follows the icon and text sizes of the model
+  if (model_) model_->changed().connect(this, &ComboBox::OnModelChanged);
+
   if (model_) {
     ModelIndex root = model_->GetRootIndex();
     current_index_ = root.GetChildIndex(0, 0);
@@ -574,12 +523,7 @@ void ComboBox::SetCurrentIndex (int index)
       return;
     }
 
-    ModelIndex tmp = root.GetChildIndex(0, 0);
-
-    while ((index > 0) && tmp.valid()) {
-      tmp = tmp.GetDownIndex();
-      index--;
-    }
+    ModelIndex tmp = model_->GetIndex(index, 0, root);
 
     if (current_index_ != tmp) {
       current_index_ = tmp;
@@ -981,4 +925,10 @@ void ComboBox::OnPopupListDestroyed (AbstractFrame* frame)
   RequestRedraw();
 }
 
+void ComboBox::OnModelChanged ()
+{
+  InvalidateSizeHint();
+  RequestRedraw();
+}
+
 } // namespace BlendInt
@@ -30,15 +30,16 @@
 namespace BlendInt {
 
 CVImageView::CVImageView ()
-    : AbstractScrollable(), off_screen_context_(0), flags_(0)
+    : AbstractScrollable(),
+      capturing_(false),
+      pending_frames_(0),
+      interval_(1000 / 15),
+      alive_(new CVImageView*(this)),
+      flags_(0)
 {
   set_size(400, 300);
   image_size_.reset(400, 300);
 
-  timer_.reset(new Timer);
-
-  timer_->timeout().connect(this, &CVImageView::OnUpdateFrame);
-
   std::vector<GLfloat> inner_verts;
   GenerateVertices(size(), 0.f, RoundNone, 0.f, &inner_verts, 0);
 
@@ -86,16 +87,15 @@ CVImageView::CVImageView ()
 
 CVImageView::~CVImageView ()
 {
+  StopCapture();
+  alive_.reset();
+
   if (video_stream_.isOpened()) {
     video_stream_.release();
     image_.release();
   }
 
   glDeleteVertexArrays(2, vao_);
-
-  if (off_screen_context_) {
-    delete off_screen_context_;
-  }
 }
 
 bool CVImageView::IsExpandX () const
@@ -143,24 +143,13 @@ bool CVImageView::OpenCamera (int n, int fps, const Size& resolution)
     vbo_.reset();
 
     fps = fps <= 0 ? 15 : (fps > 60 ? 60 : fps);
-    timer_->SetInterval(1000 / fps);
+    interval_ = 1000 / fps;
 
     SETBIT(flags_, DisplayModeMask);
     SETBIT(flags_, DeviceTypeMask);
     CLRBIT(flags_, StreamingMask);
     CLRBIT(flags_, PlaybackMask);
 
-    if (off_screen_context_ == 0) {
-
-      AbstractWindow* win = AbstractWindow::GetWindow(this);
-      off_screen_context_ = win->CreateSharedContext(win->size().width(),
-                                                     win->size().height(),
-                                                     WindowInvisible);
-
-    }
-
-    DBG_ASSERT(off_screen_context_);
-
     retval = true;
 
   } else {
@@ -193,47 +182,9 @@ bool CVImageView::OpenImageFile (const std::string& filename)
     vbo_.unmap();
     vbo_.reset();
 
-    texture_.bind();
-
-    switch (image_.channels()) {
-
-      case 1: {
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-        texture_.SetImage(0, GL_RED, image_.cols, image_.rows, 0, GL_RED,
-                          GL_UNSIGNED_BYTE, image_.data);
-        break;
-      }
-
-      case 2: {
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
-        texture_.SetImage(0, GL_RG, image_.cols, image_.rows, 0, GL_RG,
-                          GL_UNSIGNED_BYTE, image_.data);
-        break;
-      }
-
-      case 3: {
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 3);
-        texture_.SetImage(0, GL_RGB, image_.cols, image_.rows, 0, GL_BGR,
-                          GL_UNSIGNED_BYTE, image_.data);
-        break;
-      }
-
-      case 4: {    // opencv does not support alpha-channel,
-        // only masking, these code will never be
-        // called
-        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-        texture_.SetImage(0, GL_RGBA, image_.cols, image_.rows, 0, GL_BGRA,
-                          GL_UNSIGNED_BYTE, image_.data);
-        break;
-      }
-
-      default: {
-        break;
-      }
-    }
+    UploadTexture(image_);
 
     flags_ = 0;
-    DBG_ASSERT(off_screen_context_ == 0);
 
     RequestRedraw();
     return true;
@@ -271,24 +222,13 @@ bool CVImageView::OpenVideoFile (const std::string& filename, int fps)
     vbo_.reset();
 
     fps = fps <= 0 ? 15 : (fps > 60 ? 60 : fps);
-    timer_->SetInterval(1000 / fps);
+    interval_ = 1000 / fps;
 
     SETBIT(flags_, DisplayModeMask);
     CLRBIT(flags_, DeviceTypeMask);
     CLRBIT(flags_, StreamingMask);
     CLRBIT(flags_, PlaybackMask);
 
-    if (off_screen_context_ == 0) {
-
-      AbstractWindow* win = AbstractWindow::GetWindow(this);
-      off_screen_context_ = win->CreateSharedContext(win->size().width(),
-                                                     win->size().height(),
-                                                     WindowInvisible);
-
-    }
-
-    DBG_ASSERT(off_screen_context_);
-
     retval = true;
 
   } else {
@@ -310,7 +250,7 @@ void CVImageView::Play ()
     SETBIT(flags_, StreamingMask);
     SETBIT(flags_, VideoPlayMask);
 
-    timer_->Start();
+    StartCapture();
 
   } else {
 
@@ -318,7 +258,7 @@ void CVImageView::Play ()
 
       CLRBIT(flags_, PlaybackMask);
       SETBIT(flags_, VideoPlayMask);
-      timer_->Start();
+      StartCapture();
 
     }
 
@@ -334,7 +274,7 @@ void CVImageView::Pause ()
     if (flags_ & VideoPlayMask) {
       CLRBIT(flags_, PlaybackMask);
       SETBIT(flags_, VideoPauseMask);
-      timer_->Stop();
+      StopCapture();
     }
 
   } else {
@@ -351,7 +291,7 @@ void CVImageView::Stop ()
     if (flags_ & VideoPlayMask) {
       CLRBIT(flags_, PlaybackMask);
       SETBIT(flags_, VideoStopMask);
-      timer_->Stop();
+      StopCapture();
     }
 
   } else {
@@ -362,16 +302,10 @@ void CVImageView::Stop ()
 void CVImageView::Release ()
 {
   if (flags_ & DisplayModeMask) { // play video
+    StopCapture();
     video_stream_.release();
-    timer_->Stop();
-    if (off_screen_context_) {
-      delete off_screen_context_;
-      off_screen_context_ = 0;
-    }
   }
 
-  DBG_ASSERT(off_screen_context_ == 0);
-
   image_.release();
   flags_ = 0;
 
@@ -389,13 +323,8 @@ void CVImageView::DrawTexture ()
 {
   // TODO: use double textures
   glBindVertexArray(vao_[1]);
-  if (mutex_.try_lock()) {
-    texture_.bind();
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    mutex_.unlock();
-  } else {
-    DBG_PRINT_MSG("%s", "fail to lock");
-  }
+  texture_.bind();
+  glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
 }
 
 void CVImageView::PerformSizeUpdate (const AbstractView* source,
@@ -484,64 +413,101 @@ void CVImageView::PostDraw (AbstractWindow* context)
   AbstractWindow::shaders()->PopWidgetModelMatrix();
 }
 
-void CVImageView::OnUpdateFrame ()
+void CVImageView::StartCapture ()
 {
-  video_stream_ >> image_;
+  if (capture_thread_.joinable()) return;
 
-  if (mutex_.try_lock()) {
-    
-    off_screen_context_->MakeCurrent();
+  capturing_ = true;
+  capture_thread_ = std::thread(&CVImageView::CaptureFrames, this);
+}
 
-    if (image_.data) ProcessImage(image_);
+void CVImageView::StopCapture ()
+{
+  capturing_ = false;
+  if (capture_thread_.joinable()) capture_thread_.join();
+}
 
-    if (image_.data) {
+void CVImageView::CaptureFrames ()
+{
+  std::weak_ptr<CVImageView*> view = alive_;
+  std::chrono::steady_clock::time_point next = std::chrono::steady_clock::now();
+
+  while (capturing_) {
+
+    next += std::chrono::milliseconds(interval_);
+
+    cv::Mat frame;
+    video_stream_ >> frame;
+
+    if (frame.data) {
+
+      // drop the frame rather than queue up if the main thread is behind
+      if (pending_frames_.load() < kMaxPendingFrames) {
+        pending_frames_++;
+        AbstractWindow::PostToUIThread([view, frame] () {
+          std::shared_ptr<CVImageView*> p = view.lock();
+          if (p) {
+            (*p)->pending_frames_--;
+            (*p)->OnUpdateFrame(frame);
+          }
+        });
+      } else {
+        DBG_PRINT_MSG("%s", "Main thread is busy, lost one frame");
+      }
 
-      texture_.bind();
+    }
 
-      switch (image_.channels()) {
+    std::this_thread::sleep_until(next);
+  }
+}
 
-        case 1: {
-          glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-          texture_.SetImage(0, GL_RED, image_.cols, image_.rows, 0, GL_RED,
-                            GL_UNSIGNED_BYTE, image_.data);
-          break;
-        }
+void CVImageView::OnUpdateFrame (const cv::Mat& image)
+{
+  image_ = image;
+  ProcessImage(image_);
+  UploadTexture(image_);
+  RequestRedraw();
+}
 
-        case 2: {
-          glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
-          texture_.SetImage(0, GL_RG, image_.cols, image_.rows, 0, GL_RG,
-                            GL_UNSIGNED_BYTE, image_.data);
-          break;
-        }
+void CVImageView::UploadTexture (const cv::Mat& image)
+{
+  texture_.bind();
 
-        case 3: {
-          glPixelStorei(GL_UNPACK_ALIGNMENT, 3);
-          texture_.SetImage(0, GL_RGB, image_.cols, image_.rows, 0, GL_BGR,
-                            GL_UNSIGNED_BYTE, image_.data);
-          break;
-        }
+  switch (image.channels()) {
 
-        case 4: {
-          // opencv does not support alpha-channel, only masking, these code will never be called
-          glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-          texture_.SetImage(0, GL_RGBA, image_.cols, image_.rows, 0, GL_BGRA,
-                            GL_UNSIGNED_BYTE, image_.data);
-          break;
-        }
+    case 1: {
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+      texture_.SetImage(0, GL_RED, image.cols, image.rows, 0, GL_RED,
+                        GL_UNSIGNED_BYTE, image.data);
+      break;
+    }
 
-        default: {
-          break;
-        }
+    case 2: {
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 2);
+      texture_.SetImage(0, GL_RG, image.cols, image.rows, 0, GL_RG,
+                        GL_UNSIGNED_BYTE, image.data);
+      break;
+    }
 
-      }
+    case 3: {
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 3);
+      texture_.SetImage(0, GL_RGB, image.cols, image.rows, 0, GL_BGR,
+                        GL_UNSIGNED_BYTE, image.data);
+      break;
+    }
 
+    case 4: {
+      // opencv does not support alpha-channel, only masking, these code will never be called
+      glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+      texture_.SetImage(0, GL_RGBA, image.cols, image.rows, 0, GL_BGRA,
+                        GL_UNSIGNED_BYTE, image.data);
+      break;
     }
 
-    RequestRedraw();
-    mutex_.unlock();
+    default: {
+      break;
+    }
 
-  } else {
-    DBG_PRINT_MSG("%s", "Fail to lock mutex, lost one frame");
   }
 }
 
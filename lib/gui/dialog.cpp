@@ -143,7 +143,7 @@ Dialog::~Dialog ()
 AbstractWidget* Dialog::AddWidget (AbstractWidget* widget)
 {
   if (content_layout_->AddWidget(widget)) {
-    main_layout_->Adjust();
+    main_layout_->RequestLayout();
     return widget;
   }
 
@@ -153,7 +153,7 @@ AbstractWidget* Dialog::AddWidget (AbstractWidget* widget)
 AbstractWidget* Dialog::InsertWidget (int index, AbstractWidget* widget)
 {
   if (content_layout_->InsertWidget(index, widget)) {
-    main_layout_->Adjust();
+    main_layout_->RequestLayout();
     return widget;
   }
 
@@ -162,7 +162,7 @@ AbstractWidget* Dialog::InsertWidget (int index, AbstractWidget* widget)
 
 Size Dialog::GetPreferredSize () const
 {
-  return main_layout_->GetPreferredSize();
+  return main_layout_->GetCachedPreferredSize();
 }
 
 void Dialog::PerformSizeUpdate (const AbstractView* source,
@@ -74,6 +74,7 @@ bool ExpandButton::IsExpandX () const
 void ExpandButton::SetText (const String& text)
 {
   set_text(text);
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
@@ -197,8 +198,6 @@ bool Expander::AddWidget (AbstractWidget* widget)
 
     // TODO: change size
 
-    layout_->Adjust();
-
     return true;
   }
 
@@ -210,7 +209,6 @@ bool Expander::InsertWidget (int index, AbstractWidget* widget)
   if (layout_->InsertWidget(index, widget)) {
 
     // TODO: change size
-    layout_->Adjust();
 
     return true;
   }
@@ -223,7 +221,6 @@ bool Expander::InsertWidget (int row, int column, AbstractWidget* widget)
   if (layout_->InsertWidget(row, column, widget)) {
 
     // TODO: change size
-    layout_->Adjust();
 
     return true;
   }
@@ -288,7 +285,7 @@ Size Expander::GetPreferredSize () const
   if (orientation_ == Horizontal) {
 
     for (AbstractView* p = GetFirstSubView(); p; p = GetNextSubView(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
       w += tmp.width();
       h = std::max(h, tmp.height());
       count++;
@@ -299,7 +296,7 @@ Size Expander::GetPreferredSize () const
   } else {
 
     for (AbstractView* p = GetFirstSubView(); p; p = GetNextSubView(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
       w = std::max(w, tmp.width());
       h += tmp.height();
       count++;
@@ -317,7 +314,7 @@ bool Expander::IsExpandX () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       expand = true;
       break;
     }
@@ -331,7 +328,7 @@ bool Expander::IsExpandY () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       expand = true;
       break;
     }
@@ -508,6 +505,7 @@ void Expander::OnToggled (bool toggle)
 
   }
 
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
@@ -46,7 +46,7 @@ FileBrowser::FileBrowser ()
 
 FileBrowser::~FileBrowser ()
 {
-  glDeleteVertexArrays(2, vaos_);
+  glDeleteVertexArrays(1, &vao_);
 }
 
 bool FileBrowser::Open (const std::string& pathname)
@@ -69,6 +69,7 @@ bool FileBrowser::Open (const std::string& pathname)
     history_index_ = history_.size() - 1;
 
     highlight_index_ = -1;
+    ScrollTo(0);
 
     RequestRedraw();
   }
@@ -111,6 +112,7 @@ bool FileBrowser::OpenParent ()
   pathname_ = p.native();
 
   model_->Load(pathname_);
+  ScrollTo(0);
   RequestRedraw();
   return true;
 }
@@ -125,6 +127,7 @@ bool FileBrowser::GoBackward ()
     if (retval) {
       pathname_ = history_[history_index_];
       highlight_index_ = -1;
+      ScrollTo(0);
       RequestRedraw();
       return true;
     }
@@ -144,6 +147,7 @@ bool FileBrowser::GoForward ()
     if (retval) {
       pathname_ = history_[history_index_];
       highlight_index_ = -1;
+      ScrollTo(0);
       RequestRedraw();
       return true;
     }
@@ -182,33 +186,16 @@ void FileBrowser::SetModel (const RefPtr<AbstractItemModel>& model)
 
 ModelIndex FileBrowser::GetIndexAt (const Point& point) const
 {
-  ModelIndex index;
-
-  int rows = model_->GetRowCount();
-
-  if (rows > 0) {
-    int h = font_.height();	// the row height
-    int total = rows * h;
-
-    int i = 0;
-    if (total > size().height()) {
-      i = position().y() - point.y();
-    } else {	// no vbar
-      i = position().y() + size().height() - point.y();
-    }
+  int row = GetRowAt(point.y() - position().y());
 
-    i = i / h;
+  if (row < 0) return ModelIndex();
 
-    index = model_->GetRootIndex();
-
-    index = index.GetChildIndex(0, 0);
-    while ((i > 0) && index.valid()) {
-      index = index.GetDownIndex();
-      i--;
-    }
-  }
+  return model_->GetIndex(row, 0, model_->GetRootIndex());
+}
 
-  return index;
+int FileBrowser::GetRowHeight () const
+{
+  return font_.height();
 }
 
 Response FileBrowser::Draw (AbstractWindow* context)
@@ -222,64 +209,39 @@ Response FileBrowser::Draw (AbstractWindow* context)
   glUniform4fv(AbstractWindow::shaders()->location(Shaders::WIDGET_INNER_COLOR),
                1, AbstractWindow::theme()->box().inner.data());
 
-  glBindVertexArray(vaos_[0]);
+  glBindVertexArray(vao_);
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
 
   context->BeginPushStencil();	// inner stencil
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
   context->EndPushStencil();
 
-  AbstractWindow::shaders()->widget_simple_triangle_program()->use();
+  int y = 0;
+  const int h = font_.height();
+  int first = 0;
+  int count = GetVisibleRows(&first, &y);
 
-  glUniform4fv(
-      AbstractWindow::shaders()->location(
-          Shaders::WIDGET_SIMPLE_TRIANGLE_COLOR),
-      1, AbstractWindow::theme()->box().inner_sel.data());
+  stripes_.Draw(first, y, highlight_index_,
+                AbstractWindow::theme()->box().inner_sel.data());
 
-  glBindVertexArray(vaos_[1]);
+  if (GetModel() && count > 0) {
 
-  int y = size().height();
-  const int h = font_.height();
-  int i = 0;
-
-  while (y > 0) {
-    y -= h;
-    glUniform2f(
-        AbstractWindow::shaders()->location(
-            Shaders::WIDGET_SIMPLE_TRIANGLE_POSITION),
-        0.f, y);
-
-    if (i == highlight_index_) {
-      glUniform1i(
-          AbstractWindow::shaders()->location(
-              Shaders::WIDGET_SIMPLE_TRIANGLE_GAMMA),
-          -35);
-    } else {
-      if (i % 2 == 0) {
-        glUniform1i(
-            AbstractWindow::shaders()->location(
-                Shaders::WIDGET_SIMPLE_TRIANGLE_GAMMA),
-            0);
-      } else {
-        glUniform1i(
-            AbstractWindow::shaders()->location(
-                Shaders::WIDGET_SIMPLE_TRIANGLE_GAMMA),
-            15);
-      }
-    }
+    cells_.BeginFrame();
+    cells_.SetFont(font_);
 
-    glDrawArrays(GL_TRIANGLE_FAN, 0, 6);
-    i++;
-  }
+    // seek to the first visible row, then only walk the visible ones
+    ModelIndex index = GetModel()->GetIndex(first, 0,
+                                            GetModel()->GetRootIndex());
 
-  if (GetModel()) {
+    Rect rect(0, size().height() + GetOffset().y() - (first + 1) * h,
+              size().width(), h);
+    const AbstractForm* form = 0;
 
-    ModelIndex index = GetModel()->GetRootIndex();
-    index = index.GetChildIndex(0, 0);
+    for (int row = first; index.valid() && row < (first + count); row++) {
+      form = index.GetRawData();
+      if (form == 0) form = cells_.Get(row, 0, index.GetString());
 
-    Rect rect(0, size().height() - h, size().width(), h);
-    while (index.valid()) {
-      index.GetRawData()->DrawInRect(
+      form->DrawInRect(
           rect, AlignLeft | AlignVerticalCenter | AlignBaseline | AlignJustify,
           AbstractWindow::theme()->regular().text.data());
       index = index.GetDownIndex();
@@ -291,7 +253,7 @@ Response FileBrowser::Draw (AbstractWindow* context)
   AbstractWindow::shaders()->widget_inner_program()->use();
 
   context->BeginPopStencil();	// pop inner stencil
-  glBindVertexArray(vaos_[0]);
+  glBindVertexArray(vao_);
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
   context->EndPopStencil();
 
@@ -307,10 +269,7 @@ void FileBrowser::PerformSizeUpdate (const AbstractView* source,
 
     set_size(width, height);
 
-    GLfloat row_height = (GLfloat) font_.height();
-
     std::vector<GLfloat> inner_verts;
-    std::vector<GLfloat> row_verts;
 
     if (AbstractWindow::theme()->box().shaded) {
       GenerateVertices(size(), 0.f, round_type(), round_radius(), Vertical,
@@ -325,15 +284,9 @@ void FileBrowser::PerformSizeUpdate (const AbstractView* source,
     buffer_.bind(0);
     buffer_.set_sub_data(0, sizeof(GLfloat) * inner_verts.size(),
                          &inner_verts[0]);
-
-    GenerateVertices(Size(size().width(), row_height), 0.f, RoundNone, 0.f,
-                     &row_verts, 0);
-
-    glBindVertexArray(vaos_[1]);
-    buffer_.bind(1);
-    buffer_.set_sub_data(0, sizeof(GLfloat) * row_verts.size(), &row_verts[0]);
-
     buffer_.reset();
+
+    stripes_.Resize(width, font_.height());
   }
 
   if (source == this) {
@@ -345,37 +298,19 @@ Response FileBrowser::PerformMousePress (AbstractWindow* context)
 {
   ModelIndex index;
 
-  int rows = model_->GetRowCount();
-
-  if (rows > 0) {
-    int h = font_.height();	// the row height
+  Point local_position = context->GetGlobalCursorPosition()
+      - context->active_frame()->GetAbsolutePosition(this);
 
-    int i = 0;
-    Point local_position = context->GetGlobalCursorPosition()
-        - context->active_frame()->GetAbsolutePosition(this);
-    // TODO: count offset
+  highlight_index_ = GetRowAt(local_position.y());
 
-    i = size().height() - local_position.y();
-
-    i = i / h;
-    highlight_index_ = i;
-
-    index = model_->GetRootIndex().GetChildIndex();
-    while ((i > 0) && index.valid()) {
-      index = index.GetDownIndex();
-      i--;
-    }
-
-    if (!index.valid()) {
-      highlight_index_ = -1;
-    }
+  if (highlight_index_ >= 0) {
+    index = model_->GetIndex(highlight_index_, 0, model_->GetRootIndex());
   }
 
   //DBG_PRINT_MSG("highlight index: %d", highlight_index_);
 
   if (index.valid()) {
-    Text* t = dynamic_cast<Text*>(index.GetData().get());
-    file_selected_ = t->text();
+    file_selected_ = index.GetString();
     //DBG_PRINT_MSG("index item: %s", ConvertFromString(file_selected_).c_str());
     RequestRedraw();
   } else {
@@ -392,10 +327,7 @@ Response FileBrowser::PerformMousePress (AbstractWindow* context)
 
 void FileBrowser::InitializeFileBrowserOnce ()
 {
-  GLfloat row_height = (GLfloat) font_.height();
-
   std::vector<GLfloat> inner_verts;
-  std::vector<GLfloat> row_verts;
 
   if (AbstractWindow::theme()->box().shaded) {
     GenerateVertices(size(), 0.f, round_type(), round_radius(), Vertical,
@@ -407,9 +339,9 @@ void FileBrowser::InitializeFileBrowserOnce ()
   }
 
   buffer_.generate();
-  glGenVertexArrays(2, vaos_);
+  glGenVertexArrays(1, &vao_);
 
-  glBindVertexArray(vaos_[0]);
+  glBindVertexArray(vao_);
 
   buffer_.bind(0);
   buffer_.set_data(sizeof(GLfloat) * inner_verts.size(), &inner_verts[0]);
@@ -418,24 +350,11 @@ void FileBrowser::InitializeFileBrowserOnce ()
   GL_FLOAT,
                         GL_FALSE, 0, 0);
 
-  GenerateVertices(Size(size().width(), row_height), 0.f, RoundNone, 0.f,
-                   &row_verts, 0);
-
-  glBindVertexArray(vaos_[1]);
-  buffer_.bind(1);
-  buffer_.set_data(sizeof(GLfloat) * row_verts.size(), &row_verts[0]);
-
-  glEnableVertexAttribArray(
-      AbstractWindow::shaders()->location(
-          Shaders::WIDGET_SIMPLE_TRIANGLE_COORD));
-  glVertexAttribPointer(
-      AbstractWindow::shaders()->location(
-          Shaders::WIDGET_SIMPLE_TRIANGLE_COORD),
-      3, GL_FLOAT, GL_FALSE, 0, 0);
-
   glBindVertexArray(0);
   buffer_.reset();
 
+  stripes_.Resize(size().width(), font_.height());
+
   model_.reset(new FileSystemModel);
 
   // Load(getenv("PWD"));
@@ -25,7 +25,6 @@
 
 #include <boost/filesystem.hpp>
 
-#include <blendint/gui/text.hpp>
 #include <blendint/gui/filesystem-model.hpp>
 
 namespace BlendInt {
@@ -34,19 +33,20 @@ FileSystemModel::FileSystemModel ()
     : AbstractItemModel(), rows_(0), columns_(DefaultColumns),// temporary value
       root_(0)
 {
-  root_ = new ModelNode;
-  RefPtr<Text> data(new Text("Root Node"));
-  root_->data = data;
+  root_ = CreateNode();
+  root_->string = String("Root Node");
 }
 
 FileSystemModel::~FileSystemModel ()
 {
   Clear();
-  delete root_;
+  DestroyNode(root_);
 }
 
 bool FileSystemModel::Load (const std::string& pathname)
 {
+  table_.Invalidate();
+
   namespace fs = boost::filesystem;
   bool is_path = false;
 
@@ -74,19 +74,19 @@ bool FileSystemModel::Load (const std::string& pathname)
         status = fs::status(it->path());
 
         if (first == 0) {
-          first = new ModelNode;
+          first = CreateNode();
           first->parent = root_;
           root_->child = first;
           DBG_ASSERT(first->up == 0);
         } else {
-          first->down = new ModelNode;
+          first->down = CreateNode();
           first->down->up = first;
           first = first->down;
         }
 
         DBG_ASSERT(first->left == 0);
 
-        first->data = RefPtr<Text>(new Text(it->path().filename().native()));
+        first->string = String(it->path().filename().native());
 
         j++;
 
@@ -95,16 +95,15 @@ bool FileSystemModel::Load (const std::string& pathname)
         std::time_t time = fs::last_write_time(it->path());
         std::string time_str = std::asctime(std::localtime(&time));
         time_str.erase(time_str.size() - 1, 1);	// remove the '\n' char
-        tmp->right = new ModelNode;
-        tmp->right->data = RefPtr<Text>(new Text(time_str));
-        tmp->right->left = tmp->right;
+        tmp->right = CreateNode();
+        tmp->right->string = String(time_str);
+        tmp->right->left = tmp;
         tmp = tmp->right;
         j++;
 
-        tmp->right = new ModelNode;
-        tmp->right->data = RefPtr<Text>(
-            new Text(fs::is_directory(it->path()) ? "d" : "-"));
-        tmp->right->left = tmp->right;
+        tmp->right = CreateNode();
+        tmp->right->string = String(fs::is_directory(it->path()) ? "d" : "-");
+        tmp->right->left = tmp;
         tmp = tmp->right;
         j++;
 
@@ -113,16 +112,16 @@ bool FileSystemModel::Load (const std::string& pathname)
         } else {
           snprintf(buf, 32, " ");
         }
-        tmp->right = new ModelNode;
-        tmp->right->data = RefPtr<Text>(new Text(buf));
-        tmp->right->left = tmp->right;
+        tmp->right = CreateNode();
+        tmp->right->string = String(buf);
+        tmp->right->left = tmp;
         tmp = tmp->right;
         j++;
 
         snprintf(buf, 32, "%o", status.permissions());
-        tmp->right = new ModelNode;
-        tmp->right->data = RefPtr<Text>(new Text(buf));
-        tmp->right->left = tmp->right;
+        tmp->right = CreateNode();
+        tmp->right->string = String(buf);
+        tmp->right->left = tmp;
         j++;
 
         it++;
@@ -146,6 +145,8 @@ bool FileSystemModel::Load (const std::string& pathname)
 
 void FileSystemModel::Clear ()
 {
+  table_.Invalidate();
+
   if (root_->child) {
     ModelNode* node = root_->child;
     ModelNode* tmp = 0;
@@ -197,6 +198,8 @@ bool FileSystemModel::InsertColumns (int column,
                                      int count,
                                      const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   ModelNode* node = get_index_node(parent);
@@ -222,6 +225,8 @@ bool FileSystemModel::RemoveColumns (int column,
                                      int count,
                                      const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   ModelNode* node = get_index_node(parent);
@@ -258,6 +263,8 @@ bool FileSystemModel::RemoveColumns (int column,
 
 bool FileSystemModel::InsertRows (int row, int count, const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   DBG_ASSERT(count > 0);
@@ -275,15 +282,15 @@ bool FileSystemModel::InsertRows (int row, int count, const ModelIndex& parent)
   ModelNode* tmp = 0;
 
   char buf[32];
-  first = new ModelNode;
-  first->data = RefPtr<Text>(new Text("row 0, col 0"));
+  first = CreateNode();
+  first->string = String("row 0, col 0");
 
   // add (columns - 1) nodes at right
   tmp = first;
   for (int j = 1; j < columns_; j++) {
-    tmp->right = new ModelNode;
+    tmp->right = CreateNode();
     snprintf(buf, 32, "row 0, col %d", j);
-    tmp->right->data = RefPtr<Text>(new Text(buf));
+    tmp->right->string = String(buf);
     tmp->right->left = tmp;
     tmp = tmp->right;
   }
@@ -291,17 +298,17 @@ bool FileSystemModel::InsertRows (int row, int count, const ModelIndex& parent)
   last = first;
 
   for (int i = 1; i < count; i++) {
-    last->down = new ModelNode;
+    last->down = CreateNode();
     snprintf(buf, 32, "row %d, col 0", i);
-    last->down->data = RefPtr<Text>(new Text(buf));
+    last->down->string = String(buf);
     last->down->up = last;
 
     // add (columns - 1) nodes at right
     tmp = last->down;
     for (int j = 1; j < columns_; j++) {
-      tmp->right = new ModelNode;
+      tmp->right = CreateNode();
       snprintf(buf, 32, "row %d, col %d", i, j);
-      tmp->right->data = RefPtr<Text>(new Text(buf));
+      tmp->right->string = String(buf);
       tmp->right->left = tmp;
       tmp = tmp->right;
     }
@@ -345,6 +352,8 @@ bool FileSystemModel::InsertRows (int row, int count, const ModelIndex& parent)
 
 bool FileSystemModel::RemoveRows (int row, int count, const ModelIndex& parent)
 {
+  table_.Invalidate();
+
   if (!parent.valid()) return false;
 
   DBG_ASSERT(count > 0);
@@ -421,6 +430,13 @@ ModelIndex FileSystemModel::GetIndex (int row,
 
   if (node == 0) return index;
 
+  // top level rows are looked up in the table
+  if (parent_node == root_) {
+    if (!table_.valid()) table_.Rebuild(root_);
+    set_index_node(index, table_.cell(row, column));
+    return index;
+  }
+
   // move row down
   while (node->down && (row > 0)) {
     node = node->down;
@@ -505,7 +521,7 @@ void FileSystemModel::DestroyRow (ModelNode* node)
   ModelNode* right = 0;
   while (node) {
     right = node->right;
-    delete node;
+    DestroyNode(node);
     node = right;
   }
 }
@@ -521,15 +537,15 @@ void FileSystemModel::InsertColumns (int column, int count, ModelNode* node)
   ModelNode* tmp = 0;
 
   char buf[32];
-  first = new ModelNode;
-  first->data = RefPtr<Text>(new Text("new col 0"));
+  first = CreateNode();
+  first->string = String("new col 0");
 
   // add (columns - 1) nodes at right
   tmp = first;
   for (int j = 1; j < count; j++) {
-    tmp->right = new ModelNode;
+    tmp->right = CreateNode();
     snprintf(buf, 32, "new col %d", j);
-    tmp->right->data = RefPtr<Text>(new Text(buf));
+    tmp->right->string = String(buf);
     tmp->right->left = tmp;
     tmp = tmp->right;
   }
@@ -611,7 +627,7 @@ void FileSystemModel::DestroyColumnsInRow (int column,
 
       for (int i = 0; i < count; i++) {
         tmp = node->right;
-        delete node;
+        DestroyNode(node);
         node = tmp;
 
         if (node == 0) break;
@@ -653,7 +669,7 @@ void FileSystemModel::DestroyColumnsInRow (int column,
 
       for (int i = 0; i < count; i++) {
         tmp = node->right;
-        delete node;
+        DestroyNode(node);
         node = tmp;
 
         if (node == 0) break;
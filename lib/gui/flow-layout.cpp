@@ -48,7 +48,7 @@ FlowLayout::~FlowLayout ()
 AbstractWidget* FlowLayout::AddWidget (AbstractWidget* widget)
 {
   if (PushBackSubView(widget)) {
-    RequestRedraw();
+    RequestLayout();
     return widget;
   }
 
@@ -58,7 +58,7 @@ AbstractWidget* FlowLayout::AddWidget (AbstractWidget* widget)
 AbstractWidget* FlowLayout::InsertWidget (int index, AbstractWidget* widget)
 {
   if (InsertSubView(index, widget)) {
-    RequestRedraw();
+    RequestLayout();
     return widget;
   }
 
@@ -70,7 +70,7 @@ AbstractWidget* FlowLayout::InsertWidget (int row,
                                           AbstractWidget* widget)
 {
   if (InsertSubView(column, widget)) {
-    RequestRedraw();
+    RequestLayout();
     return widget;
   }
 
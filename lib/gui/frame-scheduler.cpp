@@ -0,0 +1,136 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <blendint/gui/frame-scheduler.hpp>
+
+namespace BlendInt {
+
+  const double FrameScheduler::kAverageWeight = 0.1;
+
+  FrameScheduler::FrameScheduler ()
+  : pending_(false),
+    animation_(false),
+    vsync_(true),
+    interval_(std::chrono::microseconds(1000000 / 60)),
+    swapped_(false),
+    frame_time_(0.0),
+    frame_delta_(0.0),
+    frame_count_(0)
+  {
+    start_ = Clock::now();
+    frame_start_ = start_;
+    frame_end_ = start_;
+    swap_start_ = start_;
+  }
+
+  FrameScheduler::~FrameScheduler ()
+  {
+  }
+
+  bool FrameScheduler::RequestFrame ()
+  {
+    return !pending_.exchange(true);
+  }
+
+  void FrameScheduler::RequestAnimationFrame ()
+  {
+    animation_ = true;
+  }
+
+  void FrameScheduler::BeginFrame ()
+  {
+    Clock::time_point now = Clock::now();
+
+    // an animation asks again in this tick if it needs one more frame
+    animation_ = false;
+
+    current_timing_ = FrameTiming();
+    current_timing_.idle = milliseconds(now - frame_end_);
+    swapped_ = false;
+
+    double time = std::chrono::duration<double>(now - start_).count();
+    frame_delta_ = frame_count_ > 0 ? time - frame_time_ : 0.0;
+    frame_time_ = time;
+    frame_start_ = now;
+    frame_count_++;
+
+    tick_.Invoke(frame_time_);
+  }
+
+  void FrameScheduler::BeginSwap ()
+  {
+    swap_start_ = Clock::now();
+
+    if (!swapped_) {
+      current_timing_.build = milliseconds(swap_start_ - frame_start_);
+      swapped_ = true;
+    }
+  }
+
+  void FrameScheduler::EndSwap ()
+  {
+    current_timing_.swap += milliseconds(Clock::now() - swap_start_);
+  }
+
+  void FrameScheduler::EndFrame ()
+  {
+    frame_end_ = Clock::now();
+
+    if (!swapped_) {
+      // nothing was drawn
+      current_timing_.build = milliseconds(frame_end_ - frame_start_);
+    }
+
+    last_timing_ = current_timing_;
+
+    average_timing_.build += kAverageWeight
+        * (last_timing_.build - average_timing_.build);
+    average_timing_.swap += kAverageWeight
+        * (last_timing_.swap - average_timing_.swap);
+    average_timing_.idle += kAverageWeight
+        * (last_timing_.idle - average_timing_.idle);
+  }
+
+  double FrameScheduler::GetWaitTimeout (bool redraw) const
+  {
+    if (!(redraw || animation_)) return -1.0;
+
+    // the swap of the previous frame waited for the display already
+    if (vsync_ && swapped_) return 0.0;
+
+    Clock::time_point next = frame_start_ + interval_;
+    Clock::time_point now = Clock::now();
+    if (next <= now) return 0.0;
+
+    return std::chrono::duration<double>(next - now).count();
+  }
+
+  void FrameScheduler::SetRefreshRate (int rate)
+  {
+    if (rate <= 0) rate = 60;
+
+    interval_ = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::microseconds(1000000 / rate));
+  }
+
+}
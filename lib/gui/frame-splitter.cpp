@@ -37,6 +37,7 @@ FrameSplitterHandle::FrameSplitterHandle (Orientation orientation)
       prev_size_(0),
       next_size_(0),
       nearby_pos_(0),
+      pending_offset_(0),
       hover_(false),
       pressed_(false)
 {
@@ -198,50 +199,71 @@ Response FrameSplitterHandle::PerformMouseMove (AbstractWindow* context)
     FrameSplitter* splitter = dynamic_cast<FrameSplitter*>(super());
     DBG_ASSERT(splitter);
 
+    int offset = 0;
     if (orientation_ == Horizontal) {
-
-      int offset = context->GetGlobalCursorPosition().y() - cursor_.y();
-      int oy1 = prev_size_ - offset;
-      int oy2 = next_size_ + offset;
-
-      if ((oy1 <= 0) || (oy2 <= 0)) {
+      offset = context->GetGlobalCursorPosition().y() - cursor_.y();
+      if (((prev_size_ - offset) <= 0) || ((next_size_ + offset) <= 0)) {
         return Finish;
       }
-
-      splitter->MoveSubViewTo(this, last_.x(), last_.y() + offset);
-
-      splitter->ResizeSubView(previous(this), previous(this)->size().width(),
-                              oy1);
-      splitter->MoveSubViewTo(previous(this), previous(this)->position().x(),
-                              nearby_pos_ + offset);
-      splitter->ResizeSubView(next(this), next(this)->size().width(), oy2);
-
     } else {
-
-      int offset = context->GetGlobalCursorPosition().x() - cursor_.x();
-      int oy1 = prev_size_ + offset;
-      int oy2 = next_size_ - offset;
-
-      if ((oy1 <= 0) || (oy2 <= 0)) {
+      offset = context->GetGlobalCursorPosition().x() - cursor_.x();
+      if (((prev_size_ + offset) <= 0) || ((next_size_ - offset) <= 0)) {
         return Finish;
       }
+    }
 
-      splitter->MoveSubViewTo(this, last_.x() + offset, last_.y());
-
-      splitter->ResizeSubView(previous(this), oy1,
-                              previous(this)->size().height());
-      splitter->ResizeSubView(next(this), oy2, next(this)->size().height());
-      splitter->MoveSubViewTo(next(this), nearby_pos_ + offset,
-                              next(this)->position().y());
-
+    // Only record the offset, the splitter applies the latest one
+    // before drawing so a fast drag resizes the frames once per frame.
+    if (splitter->pending_handle_ == this) {
+      count_skipped_resize();
+    } else if (splitter->pending_handle_) {
+      splitter->pending_handle_->ApplyDrag(splitter);
     }
 
+    pending_offset_ = offset;
+    splitter->pending_handle_ = this;
+
     RequestRedraw();
     return Finish;
   }
   return Finish;
 }
 
+void FrameSplitterHandle::ApplyDrag (FrameSplitter* splitter)
+{
+  int offset = pending_offset_;
+
+  if (orientation_ == Horizontal) {
+
+    int oy1 = prev_size_ - offset;
+    int oy2 = next_size_ + offset;
+
+    splitter->MoveSubViewTo(this, last_.x(), last_.y() + offset);
+
+    splitter->ResizeSubView(previous(this), previous(this)->size().width(),
+                            oy1);
+    splitter->MoveSubViewTo(previous(this), previous(this)->position().x(),
+                            nearby_pos_ + offset);
+    splitter->ResizeSubView(next(this), next(this)->size().width(), oy2);
+
+  } else {
+
+    int oy1 = prev_size_ + offset;
+    int oy2 = next_size_ - offset;
+
+    splitter->MoveSubViewTo(this, last_.x() + offset, last_.y());
+
+    splitter->ResizeSubView(previous(this), oy1,
+                            previous(this)->size().height());
+    splitter->ResizeSubView(next(this), oy2, next(this)->size().height());
+    splitter->MoveSubViewTo(next(this), nearby_pos_ + offset,
+                            next(this)->position().y());
+
+  }
+
+  if (splitter->pending_handle_ == this) splitter->pending_handle_ = 0;
+}
+
 // --------------------------------
 
 FrameSplitter::FrameSplitter (Orientation orientation)
@@ -249,6 +271,7 @@ FrameSplitter::FrameSplitter (Orientation orientation)
       AbstractFrame(FrameRegular),
       orientation_(orientation),
       hover_frame_(0),
+      pending_handle_(0),
       focused_frame_(0),
       focused_(false),
       pressed_(false),
@@ -311,32 +334,18 @@ AbstractFrame* FrameSplitter::InsertFrame (int index,
 
 int FrameSplitter::GetFrameIndex (AbstractFrame* frame) const
 {
-  if (frame->super() != this) return -1;
+  int index = GetSubViewIndex(frame);
+  if (index < 0) return -1;
 
-  int index = 0;
-  for (AbstractView* p = first(); p; p = next(p)) {
-    if (p == frame) break;
-
-    index++;
-    p = next(next(p));
-  }
-
-  return index;
+  return index / 2;
 }
 
 int FrameSplitter::GetHandleIndex (FrameSplitterHandle* handle) const
 {
-  if (handle->super() != this) return -1;
-
-  int index = 0;
-  for (AbstractView* p = next(first()); p; p = next(p)) {
-    if (p == handle) break;
+  int index = GetSubViewIndex(handle);
+  if (index < 0) return -1;
 
-    index++;
-    p = next(next(p));
-  }
-
-  return index;
+  return index / 2;
 }
 
 AbstractFrame* FrameSplitter::GetFrame (int index) const
@@ -374,7 +383,7 @@ bool FrameSplitter::IsExpandX () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       expand = true;
       break;
     }
@@ -388,7 +397,7 @@ bool FrameSplitter::IsExpandY () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       expand = true;
       break;
     }
@@ -409,14 +418,14 @@ Size FrameSplitter::GetPreferredSize () const
 
     if (orientation_ == Horizontal) {
       for (AbstractView* p = first(); p; p = next(p)) {
-        tmp = p->GetPreferredSize();
+        tmp = p->GetCachedPreferredSize();
         preferred_size.add_width(tmp.width());
         preferred_size.set_height(
             std::max(preferred_size.height(), tmp.height()));
       }
     } else {
       for (AbstractView* p = first(); p; p = next(p)) {
-        tmp = p->GetPreferredSize();
+        tmp = p->GetCachedPreferredSize();
         preferred_size.add_height(tmp.height());
         preferred_size.set_width(std::max(preferred_size.width(), tmp.width()));
       }
@@ -455,6 +464,7 @@ void FrameSplitter::PerformSizeUpdate (const AbstractView* source,
                                        int height)
 {
   if (target == this) {
+    if (pending_handle_) pending_handle_->ApplyDrag(this);
     set_size(width, height);
     FillSubFrames();
   }
@@ -466,6 +476,10 @@ void FrameSplitter::PerformSizeUpdate (const AbstractView* source,
 
 bool FrameSplitter::PreDraw (AbstractWindow* context)
 {
+  if (pending_handle_) {
+    pending_handle_->ApplyDrag(this);
+  }
+
   return true;
 }
 
@@ -498,7 +512,7 @@ void FrameSplitter::AlignSubFrames (Orientation orientation, const Size& size)
         MoveSubViewTo(p, x, y);
         x = x + room;
       } else {
-        handler_width = p->GetPreferredSize().width();
+        handler_width = p->GetCachedPreferredSize().width();
         ResizeSubView(p, handler_width, h);
         MoveSubViewTo(p, x, y);
         x = x + handler_width;
@@ -519,7 +533,7 @@ void FrameSplitter::AlignSubFrames (Orientation orientation, const Size& size)
         ResizeSubView(p, w, room);
         MoveSubViewTo(p, x, y);
       } else {
-        handler_height = p->GetPreferredSize().height();
+        handler_height = p->GetCachedPreferredSize().height();
         y = y - handler_height;
         ResizeSubView(p, w, handler_height);
         MoveSubViewTo(p, x, y);
@@ -705,7 +719,7 @@ int FrameSplitter::GetAverageRoom (Orientation orientation, const Size& size)
   // get all the total width/height of splitter handlers
   AbstractView* p = next(first());
   while (p) {
-    prefer = p->GetPreferredSize();
+    prefer = p->GetCachedPreferredSize();
     if (orientation == Horizontal) {
       space = prefer.width();
     } else {
@@ -734,7 +748,7 @@ void FrameSplitter::AddColumn (AbstractFrame* frame, SizePolicy policy)
 
   switch (policy) {
     case PreferredWidth: {
-      frame_size.set_width(frame->GetPreferredSize().width());
+      frame_size.set_width(frame->GetCachedPreferredSize().width());
       break;
     }
     case CurrentWidth: {
@@ -743,7 +757,7 @@ void FrameSplitter::AddColumn (AbstractFrame* frame, SizePolicy policy)
     case ExpandX: {
       int w = 0;
       for (AbstractView* p = first(); p; p = next(p)) {
-        w = p->GetPreferredSize().width();
+        w = p->GetCachedPreferredSize().width();
       }
       frame_size.set_height(size().width() - handle->size().width() - w);
       break;
@@ -792,7 +806,7 @@ void FrameSplitter::AddRow (AbstractFrame* frame, SizePolicy policy)
 
   switch (policy) {
     case PreferredHeight: {
-      frame_size.set_height(frame->GetPreferredSize().height());
+      frame_size.set_height(frame->GetCachedPreferredSize().height());
       break;
     }
     case CurrentHeight: {
@@ -801,7 +815,7 @@ void FrameSplitter::AddRow (AbstractFrame* frame, SizePolicy policy)
     case ExpandY: {
       int h = 0;
       for (AbstractView* p = first(); p; p = next(p)) {
-        h = p->GetPreferredSize().height();
+        h = p->GetCachedPreferredSize().height();
       }
       frame_size.set_height(size().height() - handle->size().height() - h);
       break;
@@ -853,7 +867,7 @@ void FrameSplitter::InsertColumn (int index,
 
   switch (policy) {
     case PreferredWidth: {
-      frame_size.set_width(frame->GetPreferredSize().width());
+      frame_size.set_width(frame->GetCachedPreferredSize().width());
       break;
     }
     case CurrentWidth: {
@@ -862,7 +876,7 @@ void FrameSplitter::InsertColumn (int index,
     case ExpandX: {
       int w = 0;
       for (AbstractView* p = first(); p; p = next(p)) {
-        w = p->GetPreferredSize().width();
+        w = p->GetCachedPreferredSize().width();
       }
       frame_size.set_height(size().width() - handle->size().width() - w);
       break;
@@ -925,7 +939,7 @@ void FrameSplitter::InsertRow (int index,
 
   switch (policy) {
     case PreferredHeight: {
-      frame_size.set_height(frame->GetPreferredSize().height());
+      frame_size.set_height(frame->GetCachedPreferredSize().height());
       break;
     }
     case CurrentHeight: {
@@ -934,7 +948,7 @@ void FrameSplitter::InsertRow (int index,
     case ExpandY: {
       int h = 0;
       for (AbstractView* p = first(); p; p = next(p)) {
-        h = p->GetPreferredSize().height();
+        h = p->GetCachedPreferredSize().height();
       }
       frame_size.set_height(size().height() - handle->size().height() - h);
       break;
@@ -1001,7 +1015,7 @@ void FrameSplitter::DistributeHorizontally ()
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {	// widgets
 
-      if (p->IsExpandX()) {
+      if (p->IsCachedExpandX()) {
         expandable_width_sum += p->size().width();
         expandable_widths->push_back(p->size().width());
       } else {
@@ -1011,7 +1025,7 @@ void FrameSplitter::DistributeHorizontally ()
 
     } else {	// handlers
 
-      prefer_width = p->GetPreferredSize().width();
+      prefer_width = p->GetCachedPreferredSize().width();
       handler_prefer_widths->push_back(prefer_width);
       handlers_width_sum += prefer_width;
 
@@ -1106,7 +1120,7 @@ void FrameSplitter::DistributeExpandableFramesHorizontally (int unexpandable_wid
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (p->IsExpandX()) {
+      if (p->IsCachedExpandX()) {
         ResizeSubView(
             p,
             (size().width() - prefer_width_sum - unexpandable_width_sum)
@@ -1139,7 +1153,7 @@ void FrameSplitter::DistributeUnexpandableFramesHorizontally (std::deque<int>* w
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (!p->IsExpandX()) {
+      if (!p->IsCachedExpandX()) {
 
         ResizeSubView(
             p,
@@ -1178,7 +1192,7 @@ void FrameSplitter::DistributeVertically ()
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {	// widgets
 
-      if (p->IsExpandY()) {
+      if (p->IsCachedExpandY()) {
         expandable_height_sum += p->size().height();
         expandable_heights->push_back(p->size().height());
       } else {
@@ -1188,7 +1202,7 @@ void FrameSplitter::DistributeVertically ()
 
     } else {	// handlers
 
-      prefer_height = p->GetPreferredSize().height();
+      prefer_height = p->GetCachedPreferredSize().height();
       handler_prefer_heights->push_back(prefer_height);
       handlers_height_sum += prefer_height;
 
@@ -1288,7 +1302,7 @@ void FrameSplitter::DistributeExpandableFramesVertically (int unexpandable_heigh
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (p->IsExpandY()) {
+      if (p->IsCachedExpandY()) {
         ResizeSubView(
             p,
             p->size().width(),
@@ -1323,7 +1337,7 @@ void FrameSplitter::DistributeUnexpandableFramesVertically (std::deque<int>* wid
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (!p->IsExpandY()) {
+      if (!p->IsCachedExpandY()) {
 
         ResizeSubView(
             p,
@@ -1414,6 +1428,9 @@ AbstractView* FrameSplitter::RemoveSubView (AbstractView* view)
     hover_frame_ = nullptr;
   }
 
+  // the neighbours of a dragged handle may change, drop the drag
+  pending_handle_ = nullptr;
+
   // TODO: re-layout
 
   return AbstractFrame::RemoveSubView(view);
@@ -113,7 +113,7 @@ bool Frame::IsExpandY () const
 
 Size Frame::GetPreferredSize () const
 {
-  return layout_->GetPreferredSize();
+  return layout_->GetCachedPreferredSize();
 }
 
 void Frame::PerformSizeUpdate (const AbstractView* source, const AbstractView* target, int width, int height)
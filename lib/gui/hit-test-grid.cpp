@@ -0,0 +1,149 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include <blendint/gui/hit-test-grid.hpp>
+#include <blendint/gui/abstract-view.hpp>
+
+namespace BlendInt {
+
+HitTestGrid::HitTestGrid ()
+: columns_(0),
+  rows_(0),
+  cell_width_(1),
+  cell_height_(1),
+  stamp_(0)
+{
+}
+
+HitTestGrid::~HitTestGrid ()
+{
+}
+
+void HitTestGrid::Build (const AbstractView* view, unsigned int stamp)
+{
+  views_.clear();
+  cell_offsets_.clear();
+  cell_items_.clear();
+  columns_ = 0;
+  rows_ = 0;
+  stamp_ = stamp;
+
+  for (AbstractView* p = view->GetLastSubView(); p;
+       p = view->GetPreviousSubView(p)) {
+    if (!AbstractView::is_widget(p)) break;
+    views_.push_back(p);
+  }
+
+  if (views_.empty()) return;
+
+  std::reverse(views_.begin(), views_.end());
+
+  int left = views_[0]->position().x();
+  int bottom = views_[0]->position().y();
+  int right = left + views_[0]->size().width();
+  int top = bottom + views_[0]->size().height();
+
+  for (std::vector<AbstractView*>::const_iterator it = views_.begin();
+       it != views_.end(); it++) {
+    left = std::min(left, (*it)->position().x());
+    bottom = std::min(bottom, (*it)->position().y());
+    right = std::max(right, (*it)->position().x() + (*it)->size().width());
+    top = std::max(top, (*it)->position().y() + (*it)->size().height());
+  }
+
+  bounds_.set_position(left - kSlack, bottom - kSlack);
+  bounds_.set_size(right - left + 2 * kSlack, top - bottom + 2 * kSlack);
+
+  // about one widget per cell for evenly spread widgets
+  int n = static_cast<int>(std::ceil(std::sqrt((double) views_.size())));
+  columns_ = n;
+  rows_ = n;
+  cell_width_ = std::max(1, (bounds_.width() + columns_) / columns_);
+  cell_height_ = std::max(1, (bounds_.height() + rows_) / rows_);
+
+  // counting sort of the widgets into cells
+  cell_offsets_.assign(columns_ * rows_ + 1, 0);
+
+  int x0, y0, x1, y1;
+  for (size_t i = 0; i < views_.size(); i++) {
+    x0 = (views_[i]->position().x() - kSlack - bounds_.x()) / cell_width_;
+    y0 = (views_[i]->position().y() - kSlack - bounds_.y()) / cell_height_;
+    x1 = (views_[i]->position().x() + views_[i]->size().width() + kSlack
+        - bounds_.x()) / cell_width_;
+    y1 = (views_[i]->position().y() + views_[i]->size().height() + kSlack
+        - bounds_.y()) / cell_height_;
+
+    for (int y = y0; y <= y1; y++) {
+      for (int x = x0; x <= x1; x++) {
+        cell_offsets_[y * columns_ + x + 1]++;
+      }
+    }
+  }
+
+  for (size_t i = 1; i < cell_offsets_.size(); i++) {
+    cell_offsets_[i] += cell_offsets_[i - 1];
+  }
+
+  cell_items_.resize(cell_offsets_.back());
+  std::vector<int> fill(cell_offsets_.begin(), cell_offsets_.end() - 1);
+
+  for (size_t i = 0; i < views_.size(); i++) {
+    x0 = (views_[i]->position().x() - kSlack - bounds_.x()) / cell_width_;
+    y0 = (views_[i]->position().y() - kSlack - bounds_.y()) / cell_height_;
+    x1 = (views_[i]->position().x() + views_[i]->size().width() + kSlack
+        - bounds_.x()) / cell_width_;
+    y1 = (views_[i]->position().y() + views_[i]->size().height() + kSlack
+        - bounds_.y()) / cell_height_;
+
+    for (int y = y0; y <= y1; y++) {
+      for (int x = x0; x <= x1; x++) {
+        cell_items_[fill[y * columns_ + x]++] = static_cast<int>(i);
+      }
+    }
+  }
+}
+
+AbstractView* HitTestGrid::Find (const Point& point) const
+{
+  if (views_.empty()) return 0;
+
+  int x = point.x() - bounds_.x();
+  int y = point.y() - bounds_.y();
+
+  if (x < 0 || y < 0 || x > bounds_.width() || y > bounds_.height()) return 0;
+
+  int cell = (y / cell_height_) * columns_ + (x / cell_width_);
+  DBG_ASSERT(cell < (columns_ * rows_));
+
+  // from the top most widget in this cell
+  for (int i = cell_offsets_[cell + 1] - 1; i >= cell_offsets_[cell]; i--) {
+    if (views_[cell_items_[i]]->Contain(point)) return views_[cell_items_[i]];
+  }
+
+  return 0;
+}
+
+}
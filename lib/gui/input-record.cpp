@@ -0,0 +1,389 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <string.h>
+
+#include <blendint/core/types.hpp>
+#include <blendint/gui/abstract-view.hpp>
+#include <blendint/gui/input-record.hpp>
+
+namespace BlendInt {
+
+  static const char kMagic[4] = { 'B', 'I', 'I', 'R' };
+
+  static inline void write_int (FILE* file, int32_t value)
+  {
+    fwrite(&value, sizeof(value), 1, file);
+  }
+
+  static inline bool read_int (FILE* file, int32_t* value)
+  {
+    return fread(value, sizeof(int32_t), 1, file) == 1;
+  }
+
+  static bool read_event (FILE* file, InputEvent* event, uint64_t* offset)
+  {
+    uint8_t type = 0;
+    int32_t v[4] = { 0, 0, 0, 0 };
+
+    if (fread(&type, sizeof(type), 1, file) != 1) return false;
+    if (fread(offset, sizeof(uint64_t), 1, file) != 1) return false;
+
+    event->type = (InputEventType) type;
+
+    switch (event->type) {
+
+      case InputEventKey: {
+        for (int i = 0; i < 4; i++) {
+          if (!read_int(file, &v[i])) return false;
+        }
+        event->key = v[0];
+        event->scancode = v[1];
+        event->key_action = (KeyAction) v[2];
+        event->modifiers = v[3];
+        break;
+      }
+
+      case InputEventChar: {
+        if (!read_int(file, &v[0])) return false;
+        event->character = (unsigned int) v[0];
+        break;
+      }
+
+      case InputEventMouseButton: {
+        for (int i = 0; i < 3; i++) {
+          if (!read_int(file, &v[i])) return false;
+        }
+        event->mouse_action = (MouseAction) v[0];
+        event->mouse_button = (MouseButton) v[1];
+        event->modifiers = v[2];
+        break;
+      }
+
+      case InputEventCursor: {
+        if (!read_int(file, &v[0]) || !read_int(file, &v[1])) return false;
+        event->cursor.reset(v[0], v[1]);
+        break;
+      }
+
+      case InputEventSize: {
+        if (!read_int(file, &v[0]) || !read_int(file, &v[1])) return false;
+        event->size.reset(v[0], v[1]);
+        break;
+      }
+
+      case InputEventPosition: {
+        if (!read_int(file, &v[0]) || !read_int(file, &v[1])) return false;
+        event->position.reset(v[0], v[1]);
+        break;
+      }
+
+      default:
+        return false;
+    }
+
+    return true;
+  }
+
+  InputRecorder::InputRecorder ()
+  : file_(0), frame_count_(0)
+  {
+  }
+
+  InputRecorder::~InputRecorder ()
+  {
+    Close();
+  }
+
+  bool InputRecorder::Open (const char* filename)
+  {
+    Close();
+
+    file_ = fopen(filename, "wb");
+    if (file_ == 0) {
+      DBG_PRINT_MSG("Error: cannot open %s for recording", filename);
+      return false;
+    }
+
+    fwrite(kMagic, sizeof(kMagic), 1, file_);
+    write_int(file_, kVersion);
+
+    start_ = InputEvent::Clock::now();
+    frame_count_ = 0;
+
+    return true;
+  }
+
+  void InputRecorder::Close ()
+  {
+    if (file_) {
+      fclose(file_);
+      file_ = 0;
+    }
+  }
+
+  void InputRecorder::Record (const std::deque<InputEvent>& events)
+  {
+    if ((file_ == 0) || events.empty()) return;
+
+    write_int(file_, (int32_t) events.size());
+
+    std::deque<InputEvent>::const_iterator it;
+    for (it = events.begin(); it != events.end(); it++) {
+
+      uint8_t type = (uint8_t) it->type;
+      uint64_t offset = 0;
+      if (it->timestamp > start_) {
+        offset = (uint64_t) std::chrono::duration_cast<
+            std::chrono::microseconds>(it->timestamp - start_).count();
+      }
+
+      fwrite(&type, sizeof(type), 1, file_);
+      fwrite(&offset, sizeof(offset), 1, file_);
+
+      switch (it->type) {
+
+        case InputEventKey: {
+          write_int(file_, it->key);
+          write_int(file_, it->scancode);
+          write_int(file_, it->key_action);
+          write_int(file_, it->modifiers);
+          break;
+        }
+
+        case InputEventChar: {
+          write_int(file_, (int32_t) it->character);
+          break;
+        }
+
+        case InputEventMouseButton: {
+          write_int(file_, it->mouse_action);
+          write_int(file_, it->mouse_button);
+          write_int(file_, it->modifiers);
+          break;
+        }
+
+        case InputEventCursor: {
+          write_int(file_, it->cursor.x());
+          write_int(file_, it->cursor.y());
+          break;
+        }
+
+        case InputEventSize: {
+          write_int(file_, it->size.width());
+          write_int(file_, it->size.height());
+          break;
+        }
+
+        case InputEventPosition: {
+          write_int(file_, it->position.x());
+          write_int(file_, it->position.y());
+          break;
+        }
+
+        default:
+          break;
+      }
+
+    }
+
+    frame_count_++;
+  }
+
+  // ---------------------------------------------------------------
+
+  InputReplayer::InputReplayer ()
+  : next_frame_(0),
+    realtime_(false),
+    close_when_finished_(false),
+    frame_active_(false),
+    started_(false),
+    frame_cpu_start_(0),
+    frame_draw_start_(0)
+  {
+  }
+
+  InputReplayer::~InputReplayer ()
+  {
+  }
+
+  bool InputReplayer::Load (const char* filename)
+  {
+    events_.clear();
+    frames_.clear();
+    offsets_.clear();
+    stats_.clear();
+    next_frame_ = 0;
+    frame_active_ = false;
+    started_ = false;
+
+    FILE* file = fopen(filename, "rb");
+    if (file == 0) {
+      DBG_PRINT_MSG("Error: cannot open %s for replaying", filename);
+      return false;
+    }
+
+    char magic[4];
+    int32_t version = 0;
+    if ((fread(magic, sizeof(magic), 1, file) != 1)
+        || (memcmp(magic, kMagic, sizeof(kMagic)) != 0)
+        || (!read_int(file, &version))
+        || (version != (int32_t) InputRecorder::kVersion)) {
+      DBG_PRINT_MSG("Error: %s is not an input recording", filename);
+      fclose(file);
+      return false;
+    }
+
+    int32_t count = 0;
+    InputEvent event;
+    uint64_t offset = 0;
+    bool ok = true;
+
+    while (ok && read_int(file, &count)) {
+
+      if (count <= 0) {
+        // a broken batch header, keep the complete batches before it
+        DBG_PRINT_MSG("Warning: %s has a bad batch header", filename);
+        break;
+      }
+
+      frames_.push_back(events_.size());
+
+      for (int32_t i = 0; i < count; i++) {
+        if (!read_event(file, &event, &offset)) {
+          ok = false;
+          break;
+        }
+        events_.push_back(event);
+        offsets_.push_back(offset);
+      }
+
+    }
+
+    fclose(file);
+
+    if (!ok) {
+      // drop the truncated batch, which is always the last one pushed
+      DBG_PRINT_MSG("Warning: %s is truncated", filename);
+      events_.resize(frames_.back());
+      offsets_.resize(frames_.back());
+      frames_.pop_back();
+    }
+
+    stats_.reserve(frames_.size());
+
+    return !frames_.empty();
+  }
+
+  int InputReplayer::Feed (std::deque<InputEvent>& queue)
+  {
+    if (frame_active_ || (next_frame_ >= frames_.size())) return 0;
+
+    InputEvent::Clock::time_point now = InputEvent::Clock::now();
+    if (!started_) {
+      start_ = now;
+      started_ = true;
+    }
+
+    size_t begin = frames_[next_frame_];
+    size_t end = (next_frame_ + 1) < frames_.size() ?
+        frames_[next_frame_ + 1] : events_.size();
+
+    if (realtime_) {
+      uint64_t elapsed = (uint64_t) std::chrono::duration_cast<
+          std::chrono::microseconds>(now - start_).count();
+      if (elapsed < offsets_[end - 1]) return 0;
+    }
+
+    for (size_t i = begin; i < end; i++) {
+      queue.push_back(events_[i]);
+      // latency is measured from the time the event is replayed
+      queue.back().timestamp = now;
+    }
+
+    next_frame_++;
+
+    frame_active_ = true;
+    frame_start_ = now;
+    frame_cpu_start_ = clock();
+    frame_draw_start_ = AbstractView::draw_count();
+
+    FrameStats stats;
+    stats.events = (int) (end - begin);
+    stats.cpu_time = 0.0;
+    stats.wall_time = 0.0;
+    stats.draws = 0;
+    stats.presented = false;
+    stats_.push_back(stats);
+
+    return stats.events;
+  }
+
+  void InputReplayer::EndFrame (bool presented)
+  {
+    if (!frame_active_) return;
+
+    FrameStats& stats = stats_.back();
+    stats.cpu_time = 1000.0 * (clock() - frame_cpu_start_) / CLOCKS_PER_SEC;
+    stats.wall_time = std::chrono::duration<double, std::milli>(
+        InputEvent::Clock::now() - frame_start_).count();
+    stats.draws = AbstractView::draw_count() - frame_draw_start_;
+    stats.presented = presented;
+
+    frame_active_ = false;
+  }
+
+  void InputReplayer::PrintStats (FILE* stream) const
+  {
+    double cpu_total = 0.0;
+    double wall_total = 0.0;
+    double cpu_max = 0.0;
+    unsigned int draw_total = 0;
+    int presented = 0;
+
+    fprintf(stream, "frame\tevents\tcpu(ms)\twall(ms)\tdraws\n");
+
+    for (size_t i = 0; i < stats_.size(); i++) {
+      const FrameStats& s = stats_[i];
+      fprintf(stream, "%lu\t%d\t%.3f\t%.3f\t%u%s\n", (unsigned long) i,
+              s.events, s.cpu_time, s.wall_time, s.draws,
+              s.presented ? "" : "\t(not presented)");
+
+      cpu_total += s.cpu_time;
+      wall_total += s.wall_time;
+      if (s.cpu_time > cpu_max) cpu_max = s.cpu_time;
+      draw_total += s.draws;
+      if (s.presented) presented++;
+    }
+
+    if (stats_.empty()) return;
+
+    fprintf(stream,
+            "%lu frames (%d presented), cpu: %.3f ms total, %.3f ms avg, "
+            "%.3f ms max, wall: %.3f ms total, draws: %u total, %.1f avg\n",
+            (unsigned long) stats_.size(), presented, cpu_total,
+            cpu_total / stats_.size(), cpu_max, wall_total, draw_total,
+            (double) draw_total / stats_.size());
+  }
+
+}
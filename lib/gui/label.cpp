@@ -71,12 +71,14 @@ Label::~Label ()
 void Label::SetText (const String& text)
 {
   text_->SetText(text);
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
 void Label::SetFont (const Font& font)
 {
   text_->SetFont(font);
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
@@ -28,13 +28,26 @@ namespace BlendInt {
 LinearAdjustment::LinearAdjustment(AbstractView* view,
                                    Orientation orient,
                                    int alignment,
-                                   int space)
+                                   int space,
+                                   Buffer* buffer)
     : AbstractAdjustment(view),
       orientation_(orient),
       alignment_(alignment),
-      space_(space)
+      space_(space),
+      expandable_preferred_width_list_(
+          buffer ? buffer->expandable_preferred_width_list :
+          own_buffer_.expandable_preferred_width_list),
+      expandable_preferred_height_list_(
+          buffer ? buffer->expandable_preferred_height_list :
+          own_buffer_.expandable_preferred_height_list),
+      unexpandable_preferred_width_list_(
+          buffer ? buffer->unexpandable_preferred_width_list :
+          own_buffer_.unexpandable_preferred_width_list),
+      unexpandable_preferred_height_list_(
+          buffer ? buffer->unexpandable_preferred_height_list :
+          own_buffer_.unexpandable_preferred_height_list)
 {
-
+  if (buffer) buffer->clear();
 }
 
 LinearAdjustment::~LinearAdjustment()
@@ -59,9 +72,9 @@ void LinearAdjustment::AdjustHorizontally(int x, int y, int w, int h)
   Size tmp_size;
   for (AbstractView* p = view()->GetFirstSubView(); p;
        p = view()->GetNextSubView(p)) {
-    tmp_size = p->GetPreferredSize();
+    tmp_size = p->GetCachedPreferredSize();
 
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       expandable_preferred_width_sum += tmp_size.width();
       expandable_preferred_width_list_.push_back(tmp_size.width());
     } else {
@@ -69,7 +82,7 @@ void LinearAdjustment::AdjustHorizontally(int x, int y, int w, int h)
       unexpandable_preferred_width_list_.push_back(tmp_size.width());
     }
 
-    if (!p->IsExpandY()) {
+    if (!p->IsCachedExpandY()) {
       unexpandable_preferred_height_list_.push_back(tmp_size.height());
     }
   }
@@ -104,14 +117,14 @@ void LinearAdjustment::AdjustHorizontally(int x, int y, int w, int h)
 
 void LinearAdjustment::DistributeWithPreferredWidth (int x)
 {
-  std::deque<int>::const_iterator exp_it = expandable_preferred_width_list_.begin();
-  std::deque<int>::const_iterator unexp_it = unexpandable_preferred_width_list_.begin();
+  std::vector<int>::const_iterator exp_it = expandable_preferred_width_list_.begin();
+  std::vector<int>::const_iterator unexp_it = unexpandable_preferred_width_list_.begin();
 
   AbstractView* p = view()->GetFirstSubView();
 
   while (p) {
 
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       resize(p, *exp_it, p->size().height());
       move(p, x, p->position().y());
       exp_it++;
@@ -144,8 +157,8 @@ void LinearAdjustment::DistributeWithSmallWidth (int x, int width,
   }
 
   int reference_width;
-  std::deque<int>::const_iterator exp_it = expandable_preferred_width_list_.begin();
-  std::deque<int>::const_iterator unexp_it = unexpandable_preferred_width_list_.begin();
+  std::vector<int>::const_iterator exp_it = expandable_preferred_width_list_.begin();
+  std::vector<int>::const_iterator unexp_it = unexpandable_preferred_width_list_.begin();
 
   AbstractView* p = view()->GetFirstSubView();
 
@@ -154,7 +167,7 @@ void LinearAdjustment::DistributeWithSmallWidth (int x, int width,
 
     while (p) {
 
-      if (p->IsExpandX()) {
+      if (p->IsCachedExpandX()) {
         resize(p, 0, p->size().height());
         move(p, x, p->position().y());
         exp_it++;
@@ -175,7 +188,7 @@ void LinearAdjustment::DistributeWithSmallWidth (int x, int width,
 
     while (p) {
 
-      if (p->IsExpandX()) {
+      if (p->IsCachedExpandX()) {
         resize(p, reference_width * (*exp_it) / expandable_prefer_sum,
                p->size().height());
         move(p, x, p->position().y());
@@ -203,14 +216,14 @@ void LinearAdjustment::DistributeWithLargeWidth (int x, int width,
 
   int expandable_width = widgets_width - unexpandable_prefer_sum;
 
-  std::deque<int>::const_iterator exp_it = expandable_preferred_width_list_.begin();
-  std::deque<int>::const_iterator unexp_it =
+  std::vector<int>::const_iterator exp_it = expandable_preferred_width_list_.begin();
+  std::vector<int>::const_iterator unexp_it =
       unexpandable_preferred_width_list_.begin();
 
   AbstractView* p = view()->GetFirstSubView();
   while (p) {
 
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       resize(p, expandable_width * (*exp_it) / expandable_prefer_sum,
              p->size().height());
       move(p, x, p->position().y());
@@ -229,12 +242,12 @@ void LinearAdjustment::DistributeWithLargeWidth (int x, int width,
 
 void LinearAdjustment::AlignHorizontally (int y, int height)
 {
-  std::deque<int>::const_iterator unexp_it =
+  std::vector<int>::const_iterator unexp_it =
       unexpandable_preferred_height_list_.begin();
 
   for(AbstractView* p = view()->GetFirstSubView(); p; p = view()->GetNextSubView(p))
   {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
 
       resize(p, p->size().width(), height);
       move(p, p->position().x(), y);
@@ -276,9 +289,9 @@ void LinearAdjustment::AdjustVertically (int x, int y, int w, int h)
   Size tmp_size;
   for (AbstractView* p = view()->GetFirstSubView(); p;
        p = view()->GetNextSubView(p)) {
-    tmp_size = p->GetPreferredSize();
+    tmp_size = p->GetCachedPreferredSize();
 
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       expandable_preferred_height_sum += tmp_size.height();
       expandable_preferred_height_list_.push_back(tmp_size.height());
     } else {
@@ -286,7 +299,7 @@ void LinearAdjustment::AdjustVertically (int x, int y, int w, int h)
       unexpandable_preferred_height_list_.push_back(tmp_size.height());
     }
 
-    if (!p->IsExpandX()) {
+    if (!p->IsCachedExpandX()) {
       unexpandable_preferred_width_list_.push_back(tmp_size.width());
     }
   }
@@ -320,15 +333,15 @@ void LinearAdjustment::AdjustVertically (int x, int y, int w, int h)
 
 void LinearAdjustment::DistributeWithPreferredHeight (int y, int height)
 {
-  std::deque<int>::const_iterator exp_it = expandable_preferred_height_list_.begin();
-  std::deque<int>::const_iterator unexp_it = unexpandable_preferred_height_list_.begin();
+  std::vector<int>::const_iterator exp_it = expandable_preferred_height_list_.begin();
+  std::vector<int>::const_iterator unexp_it = unexpandable_preferred_height_list_.begin();
 
   AbstractView* p = view()->GetFirstSubView();
 
   y = y + height;
   while (p) {
 
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       resize(p, p->size().width(), (*exp_it));
       y = y - p->size().height();
       move(p, p->position().x(), y);
@@ -361,8 +374,8 @@ void LinearAdjustment::DistributeWithSmallHeight (int y, int height,
   }
 
   int reference_height;
-  std::deque<int>::const_iterator exp_it = expandable_preferred_height_list_.begin();
-  std::deque<int>::const_iterator unexp_it = unexpandable_preferred_height_list_.begin();
+  std::vector<int>::const_iterator exp_it = expandable_preferred_height_list_.begin();
+  std::vector<int>::const_iterator unexp_it = unexpandable_preferred_height_list_.begin();
 
   AbstractView* p = view()->GetFirstSubView();
 
@@ -372,7 +385,7 @@ void LinearAdjustment::DistributeWithSmallHeight (int y, int height,
 
     while (p) {
 
-      if (p->IsExpandY()) {
+      if (p->IsCachedExpandY()) {
         resize(p, p->size().width(), 0);
         y = y - p->size().height();
         move(p, p->position().x(), y);
@@ -394,7 +407,7 @@ void LinearAdjustment::DistributeWithSmallHeight (int y, int height,
 
     while (p) {
 
-      if (p->IsExpandY()) {
+      if (p->IsCachedExpandY()) {
         resize(p, p->size().width(),
                reference_height * (*exp_it) / expandable_prefer_sum);
         y = y - p->size().height();
@@ -423,14 +436,14 @@ void LinearAdjustment::DistributeWithLargeHeight (int y, int height,
 
   int expandable_height = widgets_height - unexpandable_prefer_sum;
 
-  std::deque<int>::const_iterator exp_it = expandable_preferred_height_list_.begin();
-  std::deque<int>::const_iterator unexp_it = unexpandable_preferred_height_list_.begin();
+  std::vector<int>::const_iterator exp_it = expandable_preferred_height_list_.begin();
+  std::vector<int>::const_iterator unexp_it = unexpandable_preferred_height_list_.begin();
 
   y = y + height;
   AbstractView* p = view()->GetFirstSubView();
   while (p) {
 
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       resize(p, p->size().width(),
              expandable_height * (*exp_it) / expandable_prefer_sum);
       y = y - p->size().height();
@@ -451,12 +464,12 @@ void LinearAdjustment::DistributeWithLargeHeight (int y, int height,
 
 void LinearAdjustment::AlignVertically (int x, int width)
 {
-  std::deque<int>::const_iterator unexp_it =
+  std::vector<int>::const_iterator unexp_it =
       unexpandable_preferred_width_list_.begin();
 
   for (AbstractView* p = view()->GetFirstSubView(); p; p = view()->GetNextSubView(p)) {
 
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
 
       resize(p, width, p->size().height());
       move(p, x, p->position().y());
@@ -54,8 +54,7 @@ LinearLayout::~LinearLayout ()
 AbstractWidget* LinearLayout::AddWidget (AbstractWidget* widget)
 {
   if (PushBackSubView(widget)) {
-    Adjust();
-    RequestRedraw();
+    RequestLayout();
     return widget;
   }
 
@@ -65,8 +64,7 @@ AbstractWidget* LinearLayout::AddWidget (AbstractWidget* widget)
 AbstractWidget* LinearLayout::InsertWidget (int index, AbstractWidget* widget)
 {
   if (InsertSubView(index, widget)) {
-    Adjust();
-    RequestRedraw();
+    RequestLayout();
     return widget;
   }
 
@@ -86,8 +84,7 @@ AbstractWidget* LinearLayout::InsertWidget (int row,
     }
 
     if (InsertSubView(column, widget)) {
-      Adjust();
-      RequestRedraw();
+      RequestLayout();
       return widget;
     }
 
@@ -100,8 +97,7 @@ AbstractWidget* LinearLayout::InsertWidget (int row,
     }
 
     if (InsertSubView(row, widget)) {
-      Adjust();
-      RequestRedraw();
+      RequestLayout();
       return widget;
     }
 
@@ -117,14 +113,15 @@ void LinearLayout::Adjust ()
   int width = size().width() - margin().hsum();
   int height = size().height() - margin().vsum();
 
-  LinearAdjustment adjustment(this, orientation_, alignment_, space_);
+  LinearAdjustment adjustment(this, orientation_, alignment_, space_,
+                              &adjustment_buffer_);
   adjustment.Adjust(x, y, width, height);
 }
 
 bool LinearLayout::Remove (AbstractWidget* widget)
 {
   if (RemoveSubView(widget)) {
-    Adjust();
+    RequestLayout();
     return true;
   }
 
@@ -136,8 +133,8 @@ void LinearLayout::SetOrientation (Orientation orient)
   if (orientation_ == orient) return;
 
   orientation_ = orient;
-  Adjust();
-  RequestRedraw();
+  InvalidateSizeHint();
+  RequestLayout();
 }
 
 void LinearLayout::SetAlignment (int align)
@@ -145,8 +142,7 @@ void LinearLayout::SetAlignment (int align)
   if (alignment_ == align) return;
 
   alignment_ = align;
-  Adjust();
-  RequestRedraw();
+  RequestLayout();
 }
 
 void LinearLayout::SetSpace (int space)
@@ -154,8 +150,8 @@ void LinearLayout::SetSpace (int space)
   if (space_ == space) return;
 
   space_ = space;
-  Adjust();
-  RequestRedraw();
+  InvalidateSizeHint();
+  RequestLayout();
 }
 
 Size BlendInt::LinearLayout::GetPreferredSize () const
@@ -172,7 +168,7 @@ Size BlendInt::LinearLayout::GetPreferredSize () const
   if (orientation_ == Horizontal) {
     w = -space_;
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
 
       w += (tmp.width() + space_);
       h = std::max(h, tmp.height());
@@ -183,7 +179,7 @@ Size BlendInt::LinearLayout::GetPreferredSize () const
   } else {
     h = -space_;
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
 
       w = std::max(w, tmp.width());
       h += (tmp.height() + space_);
@@ -201,7 +197,7 @@ bool LinearLayout::IsExpandX () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       expand = true;
       break;
     }
@@ -215,7 +211,7 @@ bool LinearLayout::IsExpandY () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       expand = true;
       break;
     }
@@ -229,8 +225,7 @@ void LinearLayout::PerformMarginUpdate (const Margin& request)
   set_margin(request);
 
   if (subview_count()) {
-    Adjust();
-    RequestRedraw();
+    RequestLayout();
   }
 }
 
@@ -267,7 +262,7 @@ void LinearLayout::PerformSizeUpdate (const AbstractView* source,
 {
   if (target == this) {
     set_size(width, height);
-    Adjust();
+    RequestLayout();
   }
 
   if (source == this) {
@@ -24,10 +24,13 @@
 #include <blendint/opengl/gl-framebuffer.hpp>
 
 #include <blendint/gui/list-view.hpp>
+#include <blendint/gui/abstract-frame.hpp>
 #include <blendint/gui/abstract-window.hpp>
 
 namespace BlendInt {
 
+const float ListView::kStripeColor[4] = { 0.475f, 0.475f, 0.475f, 0.75f };
+
 ListView::ListView ()
     : AbstractItemView(), highlight_index_(-1)
 {
@@ -38,7 +41,7 @@ ListView::ListView ()
 
 ListView::~ListView ()
 {
-  glDeleteVertexArrays(2, vao_);
+  glDeleteVertexArrays(1, &vao_);
 }
 
 bool ListView::IsExpandX () const
@@ -66,10 +69,7 @@ void ListView::SetModel (const RefPtr<AbstractItemModel>& model)
     RequestRedraw();
   }
 
-  if (model_) {
-    int h = font_.height();
-    h = model_->GetRowCount() * h;	// total height
-  }
+  ScrollTo(0);
 }
 
 Size ListView::GetPreferredSize () const
@@ -79,7 +79,7 @@ Size ListView::GetPreferredSize () const
 
 Response ListView::Draw (AbstractWindow* context)
 {
-  int y = size().height();
+  int y = 0;
   const int h = font_.height();
 
   AbstractWindow::shaders()->widget_inner_program()->use();
@@ -92,62 +92,36 @@ Response ListView::Draw (AbstractWindow* context)
   glUniform4fv(AbstractWindow::shaders()->location(Shaders::WIDGET_INNER_COLOR),
                1, AbstractWindow::theme()->regular().inner.data());
 
-  glBindVertexArray(vao_[0]);
+  glBindVertexArray(vao_);
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
 
   context->BeginPushStencil();	// inner stencil
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
   context->EndPushStencil();
 
-  AbstractWindow::shaders()->widget_triangle_program()->use();
-
-  glUniform1i(
-      AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA), 0);
-  glUniform1i(
-      AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_ANTI_ALIAS),
-      0);
-  glVertexAttrib4f(AttributeColor, 0.475f, 0.475f, 0.475f, 0.75f);
-
-  glBindVertexArray(vao_[1]);
-
-  int i = 0;
-  while (y > 0) {
-    y -= h;
-
-    glUniform2f(
-        AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_POSITION),
-        0, y);
-
-    if (i == highlight_index_) {// TODO: use different functions for performance
-      glUniform1i(
-          AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA),
-          -35);
-    } else {
-      if (i % 2 == 0) {
-        glUniform1i(
-            AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA),
-            0);
-      } else {
-        glUniform1i(
-            AbstractWindow::shaders()->location(Shaders::WIDGET_TRIANGLE_GAMMA),
-            15);
-      }
-    }
+  int first = 0;
+  int count = GetVisibleRows(&first, &y);
 
-    glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    i++;
-  }
+  stripes_.Draw(first, y, highlight_index_, kStripeColor);
 
   RefPtr<AbstractItemModel> model = GetModel();
-  if (model) {
+  if (model && count > 0) {
+
+    cells_.BeginFrame();
+    cells_.SetFont(font_);
+
+    // seek to the first visible row, then only walk the visible ones
+    ModelIndex index = model->GetIndex(first, 0, model->GetRootIndex());
 
-    ModelIndex index = model->GetRootIndex();
-    index = index.GetChildIndex(0, 0);
+    Rect rect(0, size().height() + GetOffset().y() - (first + 1) * h,
+              size().width(), h);
+    const AbstractForm* form = 0;
 
-    Rect rect(0, size().height() - h, size().width(), h);
+    for (int row = first; index.valid() && row < (first + count); row++) {
+      form = index.GetRawData();
+      if (form == 0) form = cells_.Get(row, 0, index.GetString());
 
-    while (index.valid()) {
-      index.GetData()->DrawInRect(
+      form->DrawInRect(
           rect, AlignLeft | AlignVerticalCenter | AlignJustify | AlignBaseline,
           AbstractWindow::theme()->regular().text.data());
       index = index.GetDownIndex();
@@ -159,7 +133,7 @@ Response ListView::Draw (AbstractWindow* context)
   AbstractWindow::shaders()->widget_inner_program()->use();
 
   context->BeginPopStencil();	// pop inner stencil
-  glBindVertexArray(vao_[0]);
+  glBindVertexArray(vao_);
   glDrawArrays(GL_TRIANGLE_FAN, 0, outline_vertex_count(round_type()) + 2);
   glBindVertexArray(0);
   context->EndPopStencil();
@@ -169,48 +143,26 @@ Response ListView::Draw (AbstractWindow* context)
 
 Response ListView::PerformMousePress (AbstractWindow* context)
 {
-  if (model_) {
-
-    ModelIndex index;
-
-    int rows = model_->GetRowCount();
-
-    if (rows > 0) {
-      int h = font_.height();	// the row height
-      int total = rows * h;
+  Point local_position = context->GetGlobalCursorPosition()
+      - context->active_frame()->GetAbsolutePosition(this);
 
-      int i = 0;
-      if (total > size().height()) {
-        i = position().y() - context->GetGlobalCursorPosition().y();
-      } else {	// no vbar
-        i = position().y() + size().height()
-            - context->GetGlobalCursorPosition().y();
-      }
+  highlight_index_ = GetRowAt(local_position.y());
 
-      i = i / h;
-      highlight_index_ = i;
-
-      index = model_->GetRootIndex().GetChildIndex();
-      while ((i > 0) && index.valid()) {
-        index = index.GetDownIndex();
-        i--;
-      }
+  return Finish;
+}
 
-      if (!index.valid()) {
-        highlight_index_ = -1;
-      }
-    }
+ModelIndex ListView::GetIndexAt (const Point& point) const
+{
+  int row = GetRowAt(point.y() - position().y());
 
-  } else {
-    highlight_index_ = -1;
-  }
+  if (row < 0) return ModelIndex();
 
-  return Finish;
+  return model_->GetIndex(row, 0, model_->GetRootIndex());
 }
 
-ModelIndex ListView::GetIndexAt (const Point& point) const
+int ListView::GetRowHeight () const
 {
-  return ModelIndex();
+  return font_.height();
 }
 
 void ListView::PerformSizeUpdate (const AbstractView* source,
@@ -222,12 +174,7 @@ void ListView::PerformSizeUpdate (const AbstractView* source,
 
     set_size(width, height);
 
-    GLfloat h = font_.height();
-    GLfloat verts[] = { 0.f, 0.f, (GLfloat) width, 0.f, 0.f, h, (GLfloat) width,
-        h };
-
-    vbo_.bind(1);
-    vbo_.set_data(sizeof(verts), verts);
+    stripes_.Resize(width, font_.height());
 
     std::vector<GLfloat> inner_verts;
     GenerateVertices(size(), 0.f, RoundNone, 0.f, &inner_verts, 0);
@@ -244,18 +191,14 @@ void ListView::PerformSizeUpdate (const AbstractView* source,
 
 void ListView::InitializeListView ()
 {
-  GLfloat h = (GLfloat) font_.height();
-  GLfloat verts[] = { 0.f, 0.f, (GLfloat) size().width(), 0.f, 0.f, h,
-      (GLfloat) size().width(), h };
-
   std::vector<GLfloat> inner_verts;
 
   GenerateVertices(size(), 0.f, RoundNone, 0.f, &inner_verts, 0);
   vbo_.generate();
 
-  glGenVertexArrays(2, vao_);
+  glGenVertexArrays(1, &vao_);
 
-  glBindVertexArray(vao_[0]);
+  glBindVertexArray(vao_);
 
   vbo_.bind(0);
   vbo_.set_data(sizeof(GLfloat) * inner_verts.size(), &inner_verts[0]);
@@ -263,16 +206,10 @@ void ListView::InitializeListView ()
   glEnableVertexAttribArray(AttributeCoord);
   glVertexAttribPointer(AttributeCoord, 3, GL_FLOAT, GL_FALSE, 0, 0);
 
-  glBindVertexArray(vao_[1]);
-
-  vbo_.bind(1);
-  vbo_.set_data(sizeof(verts), verts);
-
-  glEnableVertexAttribArray(AttributeCoord);
-  glVertexAttribPointer(AttributeCoord, 2, GL_FLOAT, GL_FALSE, 0, 0);
-
   glBindVertexArray(0);
   vbo_.reset();
+
+  stripes_.Resize(size().width(), font_.height());
 }
 
 }
@@ -53,6 +53,22 @@ ManagedPtr& ManagedPtr::operator = (const ManagedPtr& orig)
   return *this;
 }
 
+ManagedPtr& ManagedPtr::operator = (ManagedPtr&& orig)
+{
+  if (&orig != this) {
+    AbstractView* const old = view_;
+    view_ = orig.view_;
+    orig.view_ = 0;
+
+    if(old && (--old->reference_count_ <= 0)) {
+      if(old->destroying())
+        delete old;
+    }
+  }
+
+  return *this;
+}
+
 ManagedPtr& ManagedPtr::operator = (AbstractView* view)
 {
   AbstractView* const old = view_;
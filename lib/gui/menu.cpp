@@ -131,7 +131,8 @@ bool Menu::AddWidget (AbstractWidget* item)
     int w = size().width();
     int h = size().height() - 2 * y;
 
-    LinearAdjustment adjust(this, Vertical, AlignLeft, space_);
+    LinearAdjustment adjust(this, Vertical, AlignLeft, space_,
+                            &adjustment_buffer_);
     adjust.Adjust(x, y, w, h);
 
     RequestRedraw();
@@ -150,7 +151,8 @@ bool Menu::InsertWidget (int index, AbstractWidget* item)
     int w = size().width();
     int h = size().height() - 2 * y;
 
-    LinearAdjustment adjust(this, Vertical, AlignLeft, space_);
+    LinearAdjustment adjust(this, Vertical, AlignLeft, space_,
+                            &adjustment_buffer_);
     adjust.Adjust(x, y, w, h);
 
     RequestRedraw();
@@ -172,7 +174,7 @@ Size Menu::GetPreferredSize () const
     Size tmp;
 
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
       w = std::max(w, tmp.width());
       h += tmp.height();
     }
@@ -279,7 +281,8 @@ void Menu::PerformSizeUpdate (const AbstractView* source,
     int w = size().width();
     int h = size().height() - 2 * y;
 
-    LinearAdjustment adjust(this, Vertical, AlignLeft, space_);
+    LinearAdjustment adjust(this, Vertical, AlignLeft, space_,
+                            &adjustment_buffer_);
     adjust.Adjust(x, y, w, h);
 
     RequestRedraw();
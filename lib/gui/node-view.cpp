@@ -69,7 +69,7 @@ bool NodeView::AddNode (AbstractNode* node)
 
     if (win) {
       if (previous(node)) {
-        dynamic_cast<AbstractNode*>(previous(node))->PerformFocusOff(
+        node_cast(previous(node))->PerformFocusOff(
             win);
       }
       node->PerformFocusOn(win);
@@ -92,7 +92,7 @@ bool NodeView::InsertNode (int index, AbstractNode* node)
 
       if (next(node) == 0) { // push back
         if (previous(node)) {
-          dynamic_cast<AbstractNode*>(previous(node))->PerformFocusOff(
+          node_cast(previous(node))->PerformFocusOff(
               win);
         }
         node->PerformFocusOn(win);
@@ -157,12 +157,12 @@ void NodeView::SetFocusedNode (AbstractNode* node)
       return;
     }
 
-    node = dynamic_cast<AbstractNode*>(tmp);
+    node = node_cast(tmp);
     if (node == 0) return;
   }
 
   if (last()) {
-    dynamic_cast<AbstractNode*>(last())->PerformFocusOff(win);
+    node_cast(last())->PerformFocusOff(win);
   }
 
   MoveToLast(node);
@@ -297,7 +297,7 @@ Response NodeView::PerformKeyPress (AbstractWindow* context)
   Response response = Ignore;
 
   for (AbstractView* p = last(); p; p = previous(p)) {
-    response = dynamic_cast<AbstractNode*>(p)->PerformKeyPress(context);
+    response = node_cast(p)->PerformKeyPress(context);
     if (response == Finish) break;
   }
 
@@ -313,7 +313,7 @@ Response NodeView::PerformMousePress (AbstractWindow* context)
   Response response = Ignore;
   Point local_position = context->local_cursor_position();
   for (AbstractView* p = last(); p; p = previous(p)) {
-    response = dynamic_cast<AbstractNode*>(p)->PerformMousePress(context);
+    response = node_cast(p)->PerformMousePress(context);
     context->set_local_cursor_position(local_position);
     if (response == Finish) break;
   }
@@ -330,7 +330,7 @@ Response NodeView::PerformMouseRelease (AbstractWindow* context)
   Response response = Ignore;
   Point local_position = context->local_cursor_position();
   for (AbstractView* p = last(); p; p = previous(p)) {
-    response = dynamic_cast<AbstractNode*>(p)->PerformMouseRelease(context);
+    response = node_cast(p)->PerformMouseRelease(context);
     context->set_local_cursor_position(local_position);
     if (response == Finish) {
       break;
@@ -351,7 +351,7 @@ Response NodeView::PerformMouseMove (AbstractWindow* context)
     Point local_position = context->local_cursor_position();
 
     for (AbstractView* p = last(); p; p = previous(p)) {
-      node = dynamic_cast<AbstractNode*>(p);
+      node = node_cast(p);
       response = node->PerformMouseMove(context);
       context->set_local_cursor_position(local_position);
       if (response == Finish) {
@@ -442,7 +442,7 @@ void NodeView::PerformMouseHover (AbstractWindow* context)
     Response response = Ignore;
     Point local_position = context->local_cursor_position();
     for (AbstractView* p = last(); p; p = previous(p)) {
-      response = dynamic_cast<AbstractNode*>(p)->PerformMouseHover(context);
+      response = node_cast(p)->PerformMouseHover(context);
       context->set_local_cursor_position(local_position);
       if (response == Finish) break;
     }
@@ -101,17 +101,17 @@ bool Node::InsertWidget (int index, AbstractWidget* widget)
 
 bool Node::IsExpandX () const
 {
-  return main_layout_->IsExpandX();
+  return main_layout_->IsCachedExpandX();
 }
 
 bool Node::IsExpandY () const
 {
-  return main_layout_->IsExpandY();
+  return main_layout_->IsCachedExpandY();
 }
 
 Size Node::GetPreferredSize () const
 {
-  return main_layout_->GetPreferredSize();
+  return main_layout_->GetCachedPreferredSize();
 }
 
 void Node::SetInnerColor (unsigned int color)
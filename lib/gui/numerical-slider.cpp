@@ -110,6 +110,7 @@ void NumericalSlider::SetTitle (const String& title)
     title_text_.reset(new Text(title));
   }
 
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
@@ -85,12 +85,14 @@ OptionLabel::~OptionLabel ()
 void OptionLabel::SetText (const String& text)
 {
   text_->SetText(text);
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
 void OptionLabel::SetFont (const Font& font)
 {
   text_->SetFont(font);
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
@@ -83,11 +83,11 @@ void Panel::InsertWidget (int index, AbstractWidget* widget)
 bool Panel::IsExpandX () const
 {
   if (layout_) {
-    return layout_->IsExpandX();
+    return layout_->IsCachedExpandX();
   }
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) return true;
+    if (p->IsCachedExpandX()) return true;
   }
 
   return false;
@@ -96,11 +96,11 @@ bool Panel::IsExpandX () const
 bool Panel::IsExpandY () const
 {
   if (layout_) {
-    return layout_->IsExpandY();
+    return layout_->IsCachedExpandY();
   }
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) return true;
+    if (p->IsCachedExpandY()) return true;
   }
 
   return false;
@@ -116,7 +116,7 @@ Size Panel::GetPreferredSize () const
 
     if (layout_) {
       DBG_ASSERT(subview_count() == 1);
-      prefer_size = layout_->GetPreferredSize();
+      prefer_size = layout_->GetCachedPreferredSize();
     } else {
 
       int minx = 0;
@@ -303,6 +303,10 @@ AbstractView* Panel::RemoveSubView (AbstractView* view)
   DBG_ASSERT(view == layout_);
   layout_ = 0;
 
+  // the preferred size is the bounding box of sub views from now on
+  set_size_hint_follows_subviews(true);
+  InvalidateSizeHint();
+
   return AbstractRoundWidget::RemoveSubView(view);
 }
 
@@ -116,12 +116,14 @@ Size PushButton::GetPreferredSize () const
 void PushButton::SetText (const String& text)
 {
   set_text(text);
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
 void PushButton::SetIcon (const RefPtr<AbstractIcon>& icon)
 {
   set_icon(icon);
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
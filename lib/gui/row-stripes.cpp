@@ -0,0 +1,109 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+#include <blendint/gui/row-stripes.hpp>
+#include <blendint/gui/abstract-window.hpp>
+
+namespace BlendInt {
+
+  RowStripes::RowStripes ()
+  : vao_(0),
+    capacity_(0),
+    row_height_(0)
+  {
+    vbo_.generate();
+
+    glGenVertexArrays(1, &vao_);
+    glBindVertexArray(vao_);
+
+    vbo_.bind(0);
+    vbo_.set_data(sizeof(GLfloat) * 8, 0);
+    glEnableVertexAttribArray(AttributeCoord);
+    glVertexAttribPointer(AttributeCoord, 2, GL_FLOAT, GL_FALSE, 0, 0);
+
+    vbo_.bind(1);
+    glEnableVertexAttribArray(AttributeInstance);
+    glVertexAttribPointer(AttributeInstance, 2, GL_FLOAT, GL_FALSE, 0, 0);
+    glVertexAttribDivisor(AttributeInstance, 1);
+
+    glBindVertexArray(0);
+    vbo_.reset();
+  }
+
+  RowStripes::~RowStripes ()
+  {
+    glDeleteVertexArrays(1, &vao_);
+  }
+
+  void RowStripes::Resize (int width, int row_height)
+  {
+    GLfloat w = (GLfloat) width;
+    GLfloat h = (GLfloat) row_height;
+    GLfloat verts[] = { 0.f, 0.f, w, 0.f, 0.f, h, w, h };
+
+    vbo_.bind(0);
+    vbo_.set_sub_data(0, sizeof(verts), verts);
+    vbo_.reset();
+
+    row_height_ = row_height;
+  }
+
+  void RowStripes::Draw (int first, int y, int highlight, const float* color)
+  {
+    instances_.clear();
+    if (row_height_ <= 0) return;
+
+    // the same stripes the per-row loop used to draw: every row whose
+    // top is still above the bottom edge
+    for (int row = first; (y + row_height_) > 0; row++, y -= row_height_) {
+      instances_.push_back((GLfloat) y);
+      if (row == highlight) {
+        instances_.push_back((GLfloat) kHighlightGamma);
+      } else {
+        instances_.push_back(
+            (GLfloat) ((row % 2 == 0) ? kEvenGamma : kOddGamma));
+      }
+    }
+
+    if (instances_.empty()) return;
+
+    vbo_.bind(1);
+    if (instance_count() > capacity_) {
+      capacity_ = instance_count();
+      vbo_.set_data(sizeof(GLfloat) * instances_.size(), &instances_[0],
+                    GL_STREAM_DRAW);
+    } else {
+      vbo_.set_sub_data(0, sizeof(GLfloat) * instances_.size(), &instances_[0]);
+    }
+    vbo_.reset();
+
+    AbstractWindow::shaders()->widget_stripe_program()->use();
+    glUniform4fv(AbstractWindow::shaders()->location(Shaders::WIDGET_STRIPE_COLOR),
+                 1, color);
+
+    glBindVertexArray(vao_);
+    glDrawArraysInstanced(GL_TRIANGLE_STRIP, 0, 4, instance_count());
+    glBindVertexArray(0);
+  }
+
+}
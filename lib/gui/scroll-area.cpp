@@ -73,17 +73,17 @@ void ScrollArea::SetScrollableWidget (AbstractScrollable* widget)
 
 bool ScrollArea::IsExpandX() const
 {
-  return layout_->IsExpandX();
+  return layout_->IsCachedExpandX();
 }
 
 bool ScrollArea::IsExpandY() const
 {
-  return layout_->IsExpandY();
+  return layout_->IsCachedExpandY();
 }
 
 Size ScrollArea::GetPreferredSize () const
 {
-  return layout_->GetPreferredSize();
+  return layout_->GetCachedPreferredSize();
 }
 
 void ScrollArea::PerformSizeUpdate (const AbstractView* source, const AbstractView* target, int width, int height)
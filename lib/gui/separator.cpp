@@ -48,12 +48,14 @@ Size Separator::GetPreferredSize() const
 void Separator::SetExpandX (bool expand)
 {
   expand_x_ = expand;
+  InvalidateSizeHint();
   // TODO: call superview widget to update layout
 }
 
 void Separator::SetExpandY (bool expand)
 {
   expand_y_ = expand;
+  InvalidateSizeHint();
   // TODO: call superview widget to update layout
 }
 
@@ -61,6 +63,7 @@ void Separator::SetExpand (bool expand_x, bool expand_y)
 {
   expand_x_ = expand_x;
   expand_y_ = expand_y;
+  InvalidateSizeHint();
   // TODO: call superview widget to update layout
 }
 
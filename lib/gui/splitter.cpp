@@ -474,14 +474,14 @@ Size Splitter::GetPreferredSize () const
 
     if (orientation_ == Horizontal) {
       for (AbstractView* p = first(); p; p = next(p)) {
-        tmp = p->GetPreferredSize();
+        tmp = p->GetCachedPreferredSize();
         preferred_size.add_width(tmp.width());
         preferred_size.set_height(
             std::max(preferred_size.height(), tmp.height()));
       }
     } else {
       for (AbstractView* p = first(); p; p = next(p)) {
-        tmp = p->GetPreferredSize();
+        tmp = p->GetCachedPreferredSize();
         preferred_size.add_height(tmp.height());
         preferred_size.set_width(std::max(preferred_size.width(), tmp.width()));
       }
@@ -499,7 +499,7 @@ bool Splitter::IsExpandX () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       expand = true;
       break;
     }
@@ -515,7 +515,7 @@ bool Splitter::IsExpandY () const
   bool expand = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       expand = true;
       break;
     }
@@ -526,32 +526,18 @@ bool Splitter::IsExpandY () const
 
 int Splitter::GetWidgetIndex (AbstractWidget* widget) const
 {
-  int index = 0;
-  if (widget->super() != this) return -1;
+  int index = GetSubViewIndex(widget);
+  if (index < 0) return -1;
 
-  for (AbstractView* p = first(); p; p = next(p)) {
-    if (p == widget) break;
-
-    index++;
-    p = next(next(p));
-  }
-
-  return index;
+  return index / 2;
 }
 
 int Splitter::GetHandleIndex (SplitterHandle* handle) const
 {
-  int index = 0;
-  if (handle->super() != this) return -1;
-
-  for (AbstractView* p = next(first()); p; p = next(p)) {
-    if (p == handle) break;
-
-    index++;
-    p = next(next(p));
-  }
+  int index = GetSubViewIndex(handle);
+  if (index < 0) return -1;
 
-  return index;
+  return index / 2;
 }
 
 AbstractWidget* Splitter::GetWidget (int index) const
@@ -624,7 +610,7 @@ void Splitter::AlignSubWidgets (Orientation orientation, const Size& out_size)
         MoveSubViewTo(p, x, y);
         x = x + room;
       } else {
-        handler_width = p->GetPreferredSize().width();
+        handler_width = p->GetCachedPreferredSize().width();
         ResizeSubView(p, handler_width, h);
         MoveSubViewTo(p, x, y);
         x = x + handler_width;
@@ -645,7 +631,7 @@ void Splitter::AlignSubWidgets (Orientation orientation, const Size& out_size)
         ResizeSubView(p, w, room);
         MoveSubViewTo(p, x, y);
       } else {
-        handler_height = p->GetPreferredSize().height();
+        handler_height = p->GetCachedPreferredSize().height();
         y = y - handler_height;
         ResizeSubView(p, w, handler_height);
         MoveSubViewTo(p, x, y);
@@ -703,7 +689,7 @@ void Splitter::DistributeHorizontally (int x, int width)
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {	// widgets
 
-      if (p->IsExpandX()) {
+      if (p->IsCachedExpandX()) {
         expandable_width_sum += p->size().width();
         expandable_widths->push_back(p->size().width());
       } else {
@@ -713,7 +699,7 @@ void Splitter::DistributeHorizontally (int x, int width)
 
     } else {	// handlers
 
-      prefer_width = p->GetPreferredSize().width();
+      prefer_width = p->GetCachedPreferredSize().width();
       handler_prefer_widths->push_back(prefer_width);
       handlers_width_sum += prefer_width;
 
@@ -780,7 +766,7 @@ void Splitter::DistributeVertically (int y, int height)
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {	// widgets
 
-      if (p->IsExpandY()) {
+      if (p->IsCachedExpandY()) {
         expandable_height_sum += p->size().height();
         expandable_heights->push_back(p->size().height());
       } else {
@@ -790,7 +776,7 @@ void Splitter::DistributeVertically (int y, int height)
 
     } else {	// handlers
 
-      prefer_height = p->GetPreferredSize().height();
+      prefer_height = p->GetCachedPreferredSize().height();
       handler_prefer_heights->push_back(prefer_height);
       handlers_height_sum += prefer_height;
 
@@ -902,7 +888,7 @@ void Splitter::DistributeExpandableWidgetsHorizontally (int x,
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (p->IsExpandX()) {
+      if (p->IsCachedExpandX()) {
         ResizeSubView(
             p,
             (width - prefer_width_sum - unexpandable_width_sum)
@@ -936,7 +922,7 @@ void Splitter::DistributeUnexpandableWidgetsHorizontally (int x,
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (!p->IsExpandX()) {
+      if (!p->IsCachedExpandX()) {
 
         ResizeSubView(
             p,
@@ -980,7 +966,7 @@ int Splitter::GetAverageRoom (Orientation orientation, const Size& out_size)
   sum += 1;
 
   while (p) {
-    prefer = p->GetPreferredSize();
+    prefer = p->GetCachedPreferredSize();
     if (orientation == Horizontal) {
       space = prefer.width();
     } else {
@@ -1047,7 +1033,7 @@ void Splitter::DistributeExpandableWidgetsVertically (int y,
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (p->IsExpandY()) {
+      if (p->IsCachedExpandY()) {
         ResizeSubView(
             p,
             p->size().width(),
@@ -1084,7 +1070,7 @@ void Splitter::DistributeUnexpandableWidgetsVertically (int y,
   for (AbstractView* p = first(); p; p = next(p)) {
     if (i % 2 == 0) {
 
-      if (!p->IsExpandY()) {
+      if (!p->IsCachedExpandY()) {
 
         ResizeSubView(
             p,
@@ -1126,7 +1112,7 @@ int Splitter::GetWidgetsRoom (Orientation orientation, const Size& out_size)
 
   AbstractView* p = next(first());
   while (p) {
-    prefer = p->GetPreferredSize();
+    prefer = p->GetCachedPreferredSize();
     if (orientation == Horizontal) {
       space = prefer.width();
     } else {
@@ -116,19 +116,7 @@ void StackLayout::Remove (AbstractWidget* widget)
 
 int StackLayout::GetIndex () const
 {
-  int index = 0;
-
-  for (AbstractView* p = first(); p; p = next(p)) {
-    if (p == active_widget_) {
-      break;
-    }
-
-    index++;
-  }
-
-  if (index >= subview_count()) index = -1;
-
-  return index;
+  return GetSubViewIndex(active_widget_);
 }
 
 void StackLayout::SetIndex (int index)
@@ -153,7 +141,7 @@ bool StackLayout::IsExpandX () const
   bool ret = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       ret = true;
       break;
     }
@@ -167,7 +155,7 @@ bool StackLayout::IsExpandY () const
   bool ret = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       ret = true;
       break;
     }
@@ -185,7 +173,7 @@ Size StackLayout::GetPreferredSize () const
 
     Size tmp;
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
       w = std::max(w, tmp.width());
       h = std::max(h, tmp.height());
     }
@@ -81,19 +81,7 @@ void Stack::Remove (AbstractWidget* widget)
 
 int Stack::GetIndex () const
 {
-  int index = 0;
-
-  for (AbstractView* p = first(); p; p = next(p)) {
-    if (p == active_widget_) {
-      break;
-    }
-
-    index++;
-  }
-
-  if (index >= subview_count()) index = -1;
-
-  return index;
+  return GetSubViewIndex(active_widget_);
 }
 
 void Stack::SetIndex (int index)
@@ -120,7 +108,7 @@ bool Stack::IsExpandX () const
   bool ret = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) {
+    if (p->IsCachedExpandX()) {
       ret = true;
       break;
     }
@@ -134,7 +122,7 @@ bool Stack::IsExpandY () const
   bool ret = false;
 
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) {
+    if (p->IsCachedExpandY()) {
       ret = true;
       break;
     }
@@ -152,7 +140,7 @@ Size Stack::GetPreferredSize () const
 
     Size tmp;
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
       w = std::max(w, tmp.width());
       h = std::max(h, tmp.height());
     }
@@ -21,7 +21,8 @@
  * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
  */
 
-#include <blendint/gui/text.hpp>
+#include <algorithm>
+
 #include <blendint/gui/string-list-model.hpp>
 
 namespace BlendInt {
@@ -42,9 +43,8 @@ void StringListModel::AddString (const String& string)
 {
   ModelIndex root = GetRootIndex();
   if(InsertRow(rows_, root)) {
-    RefPtr<Text> data(new Text(string));
     ModelIndex index = GetIndex(rows_ - 1, 0, root);
-    set_index_data(index, data);
+    set_index_string(index, string);
   }
 }
 
@@ -52,10 +52,9 @@ void StringListModel::InsertString (int row, const String& string)
 {
   ModelIndex root = GetRootIndex();
   if(InsertRow(row, root)) {
-    RefPtr<Text> data(new Text(string));
     int valid_row = std::min(row, rows_ - 1);
     ModelIndex index = GetIndex(valid_row, 0, root);
-    set_index_data(index, data);
+    set_index_string(index, string);
   }
 }
 
@@ -130,13 +129,9 @@ void StringListModel::Print()
 {
   ModelNode* node = root()->child;
 
-  Text* text = 0;
   int i = 0;
   while(node) {
-    text = dynamic_cast<Text*>(node->data.get());
-    if(text) {
-      DBG_PRINT_MSG("node %d: %s", i, ConvertFromString(text->text()).c_str());
-    }
+    DBG_PRINT_MSG("node %d: %s", i, ConvertFromString(node->string).c_str());
     node = node->down;
     i++;
   }
@@ -130,7 +130,7 @@ Size TabHeader::GetPreferredSize () const
     int h = 0;
 
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
       w += tmp.width();
       h = std::max(h, tmp.height());
     }
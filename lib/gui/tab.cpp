@@ -71,7 +71,7 @@ void Tab::AddWidget (const String& title, AbstractWidget* widget)
 bool Tab::IsExpandX () const
 {
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) return true;
+    if (p->IsCachedExpandX()) return true;
   }
 
   return false;
@@ -80,7 +80,7 @@ bool Tab::IsExpandX () const
 bool Tab::IsExpandY () const
 {
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) return true;
+    if (p->IsCachedExpandY()) return true;
   }
 
   return false;
@@ -92,7 +92,7 @@ Size Tab::GetPreferredSize () const
   int h = 0;
   Size tmp;
   for (AbstractView* p = first(); p; p = next(p)) {
-    tmp = p->GetPreferredSize();
+    tmp = p->GetCachedPreferredSize();
     w = std::max(w, tmp.width());
     h += tmp.height();
   }
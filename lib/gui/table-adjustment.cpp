@@ -28,11 +28,15 @@
 
 namespace BlendInt {
 
-TableAdjustment::TableAdjustment(AbstractView* view, unsigned int row, unsigned int column, int space)
+TableAdjustment::TableAdjustment(AbstractView* view, unsigned int row, unsigned int column, int space, Buffer* buffer)
     : AbstractAdjustment(view),
       row_(row),
       column_(column),
       space_(space),
+      column_expand_status_(buffer ? buffer->column_expand_status : own_buffer_.column_expand_status),
+      row_expand_status_(buffer ? buffer->row_expand_status : own_buffer_.row_expand_status),
+      column_width_list_(buffer ? buffer->column_width_list : own_buffer_.column_width_list),
+      row_height_list_(buffer ? buffer->row_height_list : own_buffer_.row_height_list),
       total_fixed_column_width_(0),
       total_fixed_row_height_(0),
       fixed_column_num_(0),
@@ -49,11 +53,12 @@ TableAdjustment::~TableAdjustment ()
 
 void TableAdjustment::Adjust (int x, int y, int w, int h)
 {
-  column_expand_status_.resize(column_, false);
-  row_expand_status_.resize(row_, false);
+  // assign() reuses the capacity of a shared buffer
+  column_expand_status_.assign(column_, false);
+  row_expand_status_.assign(row_, false);
 
-  column_width_list_.resize(column_, 0);
-  row_height_list_.resize(row_, 0);
+  column_width_list_.assign(column_, 0);
+  row_height_list_.assign(row_, 0);
 
   total_fixed_column_width_ = 0;
   total_fixed_row_height_ = 0;
@@ -90,17 +95,17 @@ void TableAdjustment::Scan()
 
   for(AbstractView* p = view()->GetFirstSubView(); p; p = view()->GetNextSubView(p))
   {
-    tmp = p->GetPreferredSize();
+    tmp = p->GetCachedPreferredSize();
 
     column_width_list_[j] = std::max(tmp.width(), column_width_list_[j]);
     row_height_list_[i] = std::max(tmp.height(), row_height_list_[i]);
 
-    if(p->IsExpandX()) {
+    if(p->IsCachedExpandX()) {
       column_expand_status_[j] = true;
       expand_x_ = true;
     }
 
-    if(p->IsExpandY()) {
+    if(p->IsCachedExpandY()) {
       row_expand_status_[i] = true;
       expand_y_ = true;
     }
@@ -55,12 +55,12 @@ void Cell::SetWidget (AbstractWidget* widget)
 
 bool Cell::IsExpandX () const
 {
-  return subview_count() ? first()->IsExpandX() : false;
+  return subview_count() ? first()->IsCachedExpandX() : false;
 }
 
 bool Cell::IsExpandY () const
 {
-  return subview_count() ? first()->IsExpandY() : false;
+  return subview_count() ? first()->IsCachedExpandY() : false;
 }
 
 Size Cell::GetPreferredSize () const
@@ -68,7 +68,7 @@ Size Cell::GetPreferredSize () const
   Size preferred_size(10, 10);
 
   if (subview_count()) {
-    preferred_size = first()->GetPreferredSize();
+    preferred_size = first()->GetCachedPreferredSize();
   }
 
   return preferred_size;
@@ -189,7 +189,7 @@ AbstractWidget* TableLayout::AddWidget (AbstractWidget* widget)
       Cell* cell = dynamic_cast<Cell*>(p);
       DBG_ASSERT(cell);
       cell->SetWidget(widget);
-      Adjust();
+      RequestLayout();
       retval = widget;
       break;
     }
@@ -208,7 +208,7 @@ AbstractWidget* TableLayout::InsertWidget (int index, AbstractWidget* widget)
     Cell* cell = dynamic_cast<Cell*>(GetSubViewAt(index));
     DBG_ASSERT(cell);
     cell->SetWidget(widget);
-    Adjust();
+    RequestLayout();
     return widget;
   } else {
     DBG_PRINT_MSG("Error: %s", "index out of range");
@@ -229,7 +229,7 @@ AbstractWidget* TableLayout::InsertWidget (int row,
   DBG_ASSERT(cell);
   cell->SetWidget(widget);
 
-  Adjust();
+  RequestLayout();
   return widget;
 }
 
@@ -240,7 +240,7 @@ void TableLayout::Adjust ()
   int w = size().width() - pixel_size(margin().hsum());
   int h = size().height() - pixel_size(margin().vsum());
 
-  TableAdjustment adjust(this, row_, column_, space_);
+  TableAdjustment adjust(this, row_, column_, space_, &adjustment_buffer_);
   adjust.Adjust(x, y, w, h);
 }
 
@@ -249,14 +249,14 @@ void TableLayout::SetSpace (int space)
   if (space_ == space) return;
 
   space_ = space;
-  Adjust();
-  RequestRedraw();
+  InvalidateSizeHint();
+  RequestLayout();
 }
 
 bool TableLayout::IsExpandX () const
 {
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) return true;
+    if (p->IsCachedExpandX()) return true;
   }
 
   return false;
@@ -265,7 +265,7 @@ bool TableLayout::IsExpandX () const
 bool TableLayout::IsExpandY () const
 {
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) return true;
+    if (p->IsCachedExpandY()) return true;
   }
 
   return false;
@@ -279,7 +279,7 @@ void TableLayout::PerformSizeUpdate (const AbstractView* source,
   if (target == this) {
 
     set_size(width, height);
-    Adjust();
+    RequestLayout();
   }
 
   if (source == this) {
@@ -291,8 +291,7 @@ void TableLayout::PerformMarginUpdate (const Margin& margin)
 {
   set_margin(margin);
 
-  Adjust();
-  RequestRedraw();
+  RequestLayout();
 }
 
 Size TableLayout::GetPreferredSize () const
@@ -309,7 +308,7 @@ Size TableLayout::GetPreferredSize () const
 
   for (AbstractView* p = first(); p; p = next(p)) {
 
-    tmp = p->GetPreferredSize();
+    tmp = p->GetCachedPreferredSize();
 
     row_width += tmp.width();
     row_height = std::max(row_height, tmp.height());
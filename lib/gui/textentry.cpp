@@ -92,6 +92,7 @@ void TextEntry::SetText (const String& text)
 
   //index_ = 0;
 
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
@@ -102,6 +103,7 @@ void TextEntry::ClearText ()
     cursor_index_ = 0;
     text_start_ = 0;
 
+    InvalidateSizeHint();
     RequestRedraw();
   }
 }
@@ -111,6 +113,7 @@ void TextEntry::SetFont (const Font& font)
   if (text_) {
     if (!(text_->font() == font)) {
       text_->SetFont(font);
+      InvalidateSizeHint();
       RequestRedraw();
     }
   }
@@ -171,6 +171,7 @@ void TextureView::SetTexture (const RefPtr<GLTexture2D>& texture)
 
   ///AdjustImageArea(size());
 
+  InvalidateSizeHint();
   RequestRedraw();
 }
 
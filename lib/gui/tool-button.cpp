@@ -230,6 +230,7 @@ namespace BlendInt {
     RefPtr<Action> action(new Action(text));
 
     action_ = action;
+    InvalidateSizeHint();
   }
 
   void ToolButton::SetAction (const String& text, const String& shortcut)
@@ -237,6 +238,7 @@ namespace BlendInt {
     RefPtr<Action> action(new Action(text, shortcut));
 
     action_ = action;
+    InvalidateSizeHint();
   }
 
   void ToolButton::SetAction (const RefPtr<AbstractIcon>& icon,
@@ -248,6 +250,7 @@ namespace BlendInt {
 
     set_icon(icon);
     set_text(text);
+    InvalidateSizeHint();
   }
 
   void ToolButton::SetAction (const RefPtr<AbstractIcon>& icon,
@@ -260,11 +263,13 @@ namespace BlendInt {
 
     set_icon(icon);
     set_text(text);
+    InvalidateSizeHint();
   }
 
   void ToolButton::SetAction (const RefPtr<Action>& item)
   {
     action_ = item;
+    InvalidateSizeHint();
   }
 
   Size ToolButton::GetPreferredSize () const
@@ -0,0 +1,74 @@
+/*
+ * This file is part of BlendInt (a Blender-like Interface Library in
+ * OpenGL).
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is free
+ * software: you can redistribute it and/or modify it under the terms
+ * of the GNU Lesser General Public License as published by the Free
+ * Software Foundation, either version 3 of the License, or (at your
+ * option) any later version.
+ *
+ * BlendInt (a Blender-like Interface Library in OpenGL) is
+ * distributed in the hope that it will be useful, but WITHOUT ANY
+ * WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU Lesser General
+ * Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public
+ * License along with BlendInt.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ *
+ * Contributor(s): Freeman Zhang <zhanggyb@gmail.com>
+ */
+
+// generate makefile with cmake on Linux with X11 found to activate
+#ifdef __USE_X11__
+
+#include <poll.h>
+#include <cmath>
+
+#include <blendint/gui/window.hpp>
+
+// included last: Xlib defines macros like KeyPress and None which
+// conflict with BlendInt names
+#define GLFW_EXPOSE_NATIVE_X11
+#include <GLFW/glfw3native.h>
+
+namespace BlendInt {
+
+bool Window::HasX11Display ()
+{
+  return glfwGetX11Display() != NULL;
+}
+
+void Window::WaitX11Events (double timeout)
+{
+  Display* display = glfwGetX11Display();
+
+  // events read into the Xlib queue already are not seen by poll()
+  if (XPending(display) == 0) {
+
+    struct pollfd fds[2];
+
+    fds[0].fd = ConnectionNumber(display);
+    fds[0].events = POLLIN;
+    fds[0].revents = 0;
+
+    fds[1].fd = kWakeupSignal.fd();
+    fds[1].events = POLLIN;
+    fds[1].revents = 0;
+
+    int ms = -1;
+    if (timeout >= 0.0) ms = (int) std::ceil(timeout * 1000.0);
+
+    poll(fds, 2, ms);
+  }
+
+  kWakeupSignal.Clear();
+
+  glfwPollEvents();
+}
+
+}
+
+#endif  // __USE_X11__
@@ -31,6 +31,8 @@
 #include <blendint/core/types.hpp>
 #include <blendint/core/image.hpp>
 #include <blendint/core/timer.hpp>
+#include <blendint/core/timer-wheel.hpp>
+#include <blendint/core/thread-pool.hpp>
 
 #include <blendint/font/fc-config.hpp>
 
@@ -50,27 +52,16 @@ GLFWcursor* Window::kIBeamCursor = NULL;
 
 std::map<GLFWwindow*, Window*> Window::kSharedWindowMap;
 
-KeyAction Window::kKeyAction = KeyNone;
+WakeupSignal Window::kWakeupSignal;
 
-int Window::kKey = 0;
-
-int Window::kModifiers = 0;
-
-int Window::kScancode = 0;
-
-String Window::kText;
-
-MouseAction Window::kMouseAction = MouseNone;
-
-MouseButton Window::kMouseButton = MouseButtonLeft;
-
-Point Window::kCursor;
+bool Window::kWaitOnDescriptor = false;
 
 Window::Window (int width, int height, const char* title, int flags)
 : AbstractWindow(width, height, flags),
   window_(0),
   running_(true),
-  visible_(false)
+  visible_(false),
+  input_height_(height)
 {
   visible_ = flags & WindowVisibleMask ? true : false;
 
@@ -95,6 +86,13 @@ Window::Window (int width, int height, const char* title, int flags)
     /* Make the window's context current */
     glfwMakeContextCurrent(window_);
 
+    glfwSwapInterval(kFrameScheduler.vsync() ? 1 : 0);
+
+    // no primary monitor is reported when headless
+    GLFWmonitor* monitor = glfwGetPrimaryMonitor();
+    const GLFWvidmode* mode = monitor ? glfwGetVideoMode(monitor) : 0;
+    if (mode) kFrameScheduler.SetRefreshRate(mode->refreshRate);
+
     if (!InitializeGLContext()) {
       DBG_PRINT_MSG("Critical: %s", "Cannot initialize GL Context");
       exit(EXIT_FAILURE);
@@ -158,59 +156,132 @@ void Window::SwapBuffer ()
 
 void Window::Synchronize ()
 {
-  glfwPostEmptyEvent();
+  // requests before the next frame starts share one wakeup
+  if (kFrameScheduler.RequestFrame()) Wakeup();
 }
 
 void Window::Exec ()
 {
-  GLFWwindow* main = dynamic_cast<Window*>(main_window())->window_;
+  Window* main_win = dynamic_cast<Window*>(main_window());
+  GLFWwindow* main = main_win->window_;
   // bool main_visiable = dynamic_cast<Window*>(main_window())->visible_;
 
   std::map<GLFWwindow*, Window*>::iterator it;
 
   while (running_) {
 
-    if (main_window()->refresh()) {
-      main_window()->MakeCurrent();
-#ifdef DEBUG
-      // Timer::SaveCurrentTime();
-#endif
-      reset_refresh_status(main_window());
-      if(predraw_window(main_window())) {
-        draw_window(main_window());
-        postdraw_window(main_window());
-      }
+    // fire due timers before the frame, they usually request redraws
+    Timer::wheel()->Advance();
 
-      // DBG_PRINT_MSG("Time of one render cycle: %g (ms)", Timer::GetIntervalOfMilliseconds());
+    // work posted by other threads
+    ProcessUITasks();
 
-      main_window()->SwapBuffer();
+    main_win->ProcessInputEvents();
+    for (it = kSharedWindowMap.begin(); it != kSharedWindowMap.end(); it++) {
+      it->second->ProcessInputEvents();
     }
 
-    for (it = kSharedWindowMap.begin(); it != kSharedWindowMap.end(); it++) {
+    // a timer, a UI task or input may not change anything on screen,
+    // only count and tick the frames which are drawn. Input is handled
+    // right away, but a redraw waits until one refresh interval after
+    // the previous frame, so fast input or timers do not push the frame
+    // rate past the display
+    bool draw = kFrameScheduler.animating() || HasPendingRedraw();
+    if (draw) draw = (kFrameScheduler.GetWaitTimeout(true) == 0.0);
+
+    if (!draw) {
+      main_win->FinishInputFrame(false);
+      for (it = kSharedWindowMap.begin(); it != kSharedWindowMap.end(); it++) {
+        it->second->FinishInputFrame(false);
+      }
+    } else {
+      DrawFrame();
+    }
 
-      if (it->second->visible_ && it->second->refresh()) {
+    if (glfwWindowShouldClose(main)) running_ = false;
 
-        glfwMakeContextCurrent(it->first);
+    InputReplayer* replayer = main_win->input_replayer();
+    if (replayer && replayer->finished() && replayer->close_when_finished()) {
+      running_ = false;
+    }
 
-        reset_refresh_status(it->second);
+    // requests from now on wake up the loop, those before are seen by
+    // GetWaitTimeout()
+    kFrameScheduler.ClearRequest();
+
+    double timeout = GetWaitTimeout();
+
+    if (main_win->replaying() || (timeout == 0.0)) {
+      // keep feeding recorded events, or start the due frame right away
+      WaitEvents(0.0);
+    } else if (timeout > 0.0) {
+      // a frame or a timer is pending but not due yet, more redraw
+      // requests only wake up the loop, input is handled right away
+      do {
+        WaitEvents(timeout);
+        timeout = GetWaitTimeout();
+      } while ((timeout > 0.0) && (!HasInputEvents()));
+    } else {
+      WaitEvents(-1.0);
+    }
 
-        if (predraw_window(it->second)) {
-          draw_window(it->second);
-          postdraw_window(it->second);
-        }
+  }
+}
 
-        glfwSwapBuffers(it->first);
-      }
+void Window::DrawFrame ()
+{
+  Window* main_win = dynamic_cast<Window*>(main_window());
+  std::map<GLFWwindow*, Window*>::iterator it;
 
+  ResetSizeHintStats();
+
+  kFrameScheduler.BeginFrame();
+
+  if (main_window()->refresh()) {
+    main_window()->MakeCurrent();
+#ifdef DEBUG
+    // Timer::SaveCurrentTime();
+#endif
+    reset_refresh_status(main_window());
+    if(predraw_window(main_window())) {
+      draw_window(main_window());
+      postdraw_window(main_window());
     }
 
-    if (glfwWindowShouldClose(main)) running_ = false;
+    // DBG_PRINT_MSG("Time of one render cycle: %g (ms)", Timer::GetIntervalOfMilliseconds());
 
-    // TODO: fire event then go idle
+    kFrameScheduler.BeginSwap();
+    main_window()->SwapBuffer();
+    kFrameScheduler.EndSwap();
+    main_win->FinishInputFrame(true);
+  } else {
+    main_win->FinishInputFrame(false);
+  }
 
-    glfwWaitEvents();
+  for (it = kSharedWindowMap.begin(); it != kSharedWindowMap.end(); it++) {
+
+    if (it->second->visible_ && it->second->refresh()) {
+
+      glfwMakeContextCurrent(it->first);
+
+      reset_refresh_status(it->second);
+
+      if (predraw_window(it->second)) {
+        draw_window(it->second);
+        postdraw_window(it->second);
+      }
+
+      kFrameScheduler.BeginSwap();
+      glfwSwapBuffers(it->first);
+      kFrameScheduler.EndSwap();
+      it->second->FinishInputFrame(true);
+    } else {
+      it->second->FinishInputFrame(false);
+    }
 
   }
+
+  kFrameScheduler.EndFrame();
 }
 
 void Window::SetCursor (CursorShape cursor_type)
@@ -261,42 +332,42 @@ void Window::SetCursor (CursorShape cursor_type)
 
 int Window::GetKeyInput () const
 {
-  return kKey;
+  return current_input().key;
 }
 
 int Window::GetScancode () const
 {
-  return kScancode;
+  return current_input().scancode;
 }
 
 MouseAction Window::GetMouseAction () const
 {
-  return kMouseAction;
+  return current_input().mouse_action;
 }
 
 KeyAction Window::GetKeyAction () const
 {
-  return kKeyAction;
+  return current_input().key_action;
 }
 
 int Window::GetModifiers () const
 {
-  return kModifiers;
+  return current_input().modifiers;
 }
 
 MouseButton Window::GetMouseButton () const
 {
-  return kMouseButton;
+  return current_input().mouse_button;
 }
 
 const String& Window::GetTextInput () const
 {
-  return kText;
+  return current_text();
 }
 
 const Point& Window::GetGlobalCursorPosition () const
 {
-  return kCursor;
+  return current_input().cursor;
 }
 
 bool Window::Initialize ()
@@ -323,6 +394,17 @@ bool Window::Initialize ()
 
   kMainThreadID = std::this_thread::get_id();
 
+#ifdef __USE_X11__
+  // wait on the X connection and our own descriptor instead of posting
+  // empty events through the X server
+  kWaitOnDescriptor = HasX11Display() && (kWakeupSignal.fd() >= 0);
+#endif
+
+  kWakeupHandler.store(&Window::Wakeup);
+
+  ThreadPool::Initialize();
+  ThreadPool::SetMainThreadDispatcher(&AbstractWindow::PostToUIThread);
+
   return true;
 }
 
@@ -336,6 +418,11 @@ void Window::Terminate ()
   glfwDestroyCursor(kTopRightCornerCursor);
   glfwDestroyCursor(kIBeamCursor);
 
+  ThreadPool::Release();
+  ThreadPool::SetMainThreadDispatcher(nullptr);
+
+  kWakeupHandler.store(nullptr);
+
   glfwTerminate();
   Fc::Config::fini();
 }
@@ -370,6 +457,7 @@ void Window::PerformSizeUpdate (const AbstractView* source,
 {
   if (target == this) {
     set_size(width, height);
+    input_height_ = height;
 
     glm::mat4 projection = glm::ortho(0.f, (float) size().width(), 0.f,
                                       (float) size().height(), 100.f, -100.f);
@@ -430,22 +518,72 @@ void Window::CbError (int error, const char* description)
   DBG_PRINT_MSG("Error: %s (error code: %d)", description, error);
 }
 
-void Window::CbWindowSize (GLFWwindow* window, int w, int h)
+void Window::Wakeup ()
 {
-  Window* win = 0;
-  std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
-  if (it != kSharedWindowMap.end()) {
-    win = it->second;
+  if (kWaitOnDescriptor) {
+    kWakeupSignal.Signal();
   } else {
-    win = dynamic_cast<Window*>(main_window());
+    glfwPostEmptyEvent();
   }
+}
 
-  DBG_ASSERT(win);
+void Window::WaitEvents (double timeout)
+{
+#ifdef __USE_X11__
+  if (kWaitOnDescriptor) {
+    WaitX11Events(timeout);
+    return;
+  }
+#endif
 
-  win->PerformSizeUpdate(0, win, w, h);
+  if (timeout < 0.0) {
+    glfwWaitEvents();
+  } else if (timeout == 0.0) {
+    glfwPollEvents();
+  } else {
+    glfwWaitEventsTimeout(timeout);
+  }
 }
 
-void Window::CbWindowPosition (GLFWwindow* window, int x, int y)
+double Window::GetWaitTimeout ()
+{
+  // tasks posted before the request was cleared did not wake us up
+  if (ui_task_depth() > 0) return 0.0;
+
+  double frame = kFrameScheduler.GetWaitTimeout(HasPendingRedraw());
+  double timer = Timer::wheel()->GetWaitTimeout();
+
+  if (frame < 0.0) return timer;
+  if (timer < 0.0) return frame;
+
+  return frame < timer ? frame : timer;
+}
+
+bool Window::HasInputEvents ()
+{
+  if (main_window()->has_input_events()) return true;
+
+  std::map<GLFWwindow*, Window*>::iterator it;
+  for (it = kSharedWindowMap.begin(); it != kSharedWindowMap.end(); it++) {
+    if (it->second->has_input_events()) return true;
+  }
+
+  return false;
+}
+
+bool Window::HasPendingRedraw ()
+{
+  if (main_window()->refresh()) return true;
+
+  std::map<GLFWwindow*, Window*>::iterator it;
+  for (it = kSharedWindowMap.begin(); it != kSharedWindowMap.end(); it++) {
+    if (it->second->visible_ && it->second->refresh()) return true;
+  }
+
+  return false;
+}
+
+Window* Window::FindWindow (GLFWwindow* window)
 {
   Window* win = 0;
   std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
@@ -456,8 +594,24 @@ void Window::CbWindowPosition (GLFWwindow* window, int x, int y)
   }
 
   DBG_ASSERT(win);
+  return win;
+}
 
-  win->PerformPositionUpdate(0, win, x, y);
+void Window::CbWindowSize (GLFWwindow* window, int w, int h)
+{
+  Window* win = FindWindow(window);
+
+  InputEvent event(InputEventSize);
+  event.size.reset(w, h);
+  win->input_height_ = h;
+  win->PostInputEvent(event);
+}
+
+void Window::CbWindowPosition (GLFWwindow* window, int x, int y)
+{
+  InputEvent event(InputEventPosition);
+  event.position.reset(x, y);
+  FindWindow(window)->PostInputEvent(event);
 }
 
 void Window::CbKey (GLFWwindow* window,
@@ -466,68 +620,32 @@ void Window::CbKey (GLFWwindow* window,
                     int action,
                     int mods)
 {
-  Window* win = 0;
-  std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
-  if (it != kSharedWindowMap.end()) {
-    win = it->second;
-  } else {
-    win = dynamic_cast<Window*>(main_window());
-  }
-
-  DBG_ASSERT(win);
+  InputEvent event(InputEventKey);
 
   switch (action) {
     case GLFW_PRESS:
-      kKeyAction = KeyPress;
+      event.key_action = KeyPress;
       break;
     case GLFW_RELEASE:
-      kKeyAction = KeyRelease;
+      event.key_action = KeyRelease;
       break;
     case GLFW_REPEAT:
-      kKeyAction = KeyRepeat;
+      event.key_action = KeyRepeat;
       break;
     default:
-      kKeyAction = KeyNone;
+      event.key_action = KeyNone;
       break;
   }
 
-  kKey = key;
-  kModifiers = mods;
-  kScancode = scancode;
-  kText.clear();
-
-  switch (kKeyAction) {
-
-    case KeyPress: {
-      win->PerformKeyPress(win);
-      break;
-    }
-
-    case KeyRelease: {
-      break;
-    }
+  event.key = key;
+  event.modifiers = mods;
+  event.scancode = scancode;
 
-    case KeyRepeat: {
-      break;
-    }
-
-    default:
-      break;
-  }
+  FindWindow(window)->PostInputEvent(event);
 }
 
 void Window::CbChar (GLFWwindow* window, unsigned int character)
 {
-  Window* win = 0;
-  std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
-  if (it != kSharedWindowMap.end()) {
-    win = it->second;
-  } else {
-    win = dynamic_cast<Window*>(main_window());
-  }
-
-  DBG_ASSERT(win);
-
 #ifdef __APPLE__
   // glfw3 in Mac OS will call this function if press some unprintalbe keys such as Left, Right, Up, Down
   if (character > 255) {
@@ -536,28 +654,9 @@ void Window::CbChar (GLFWwindow* window, unsigned int character)
   }
 #endif
 
-  kText.clear();
-  kText.push_back(character);
-
-  switch (kKeyAction) {
-
-    case KeyPress: {
-      win->PerformKeyPress(win);
-      break;
-    }
-
-    case KeyRelease: {
-      break;
-    }
-
-    case KeyRepeat: {
-      break;
-    }
-
-    default:
-      break;
-  }
-
+  InputEvent event(InputEventChar);
+  event.character = character;
+  FindWindow(window)->PostInputEvent(event);
 }
 
 void Window::CbMouseButton (GLFWwindow* window,
@@ -565,115 +664,46 @@ void Window::CbMouseButton (GLFWwindow* window,
                             int action,
                             int mods)
 {
-  Window* win = 0;
-  std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
-  if (it != kSharedWindowMap.end()) {
-    win = it->second;
-  } else {
-    win = dynamic_cast<Window*>(main_window());
-  }
-
-  DBG_ASSERT(win);
+  InputEvent event(InputEventMouseButton);
 
   switch (action) {
     case GLFW_RELEASE:
-      kMouseAction = MouseRelease;
+      event.mouse_action = MouseRelease;
       break;
     case GLFW_PRESS:
-      kMouseAction = MousePress;
-      break;
-    case GLFW_REPEAT:
-      kMouseAction = MouseNone;
+      event.mouse_action = MousePress;
       break;
     default:
+      event.mouse_action = MouseNone;
       break;
   }
 
-  kMouseButton = MouseButtonNone;
-
   switch (button) {
     case GLFW_MOUSE_BUTTON_1:
-      kMouseButton = MouseButtonLeft;
+      event.mouse_button = MouseButtonLeft;
       break;
     case GLFW_MOUSE_BUTTON_2:
-      kMouseButton = MouseButtonRight;
+      event.mouse_button = MouseButtonRight;
       break;
     case GLFW_MOUSE_BUTTON_3:
-      kMouseButton = MouseButtonMiddle;
+      event.mouse_button = MouseButtonMiddle;
       break;
     default:
       break;
   }
 
-  kModifiers = mods;
-
-  switch (kMouseAction) {
-
-    case MouseMove: {
-      win->DispatchMouseHover();
-      win->PerformMouseMove(win);
-      break;
-    }
-
-    case MousePress: {
-      win->DispatchMouseHover();
-      win->PerformMousePress(win);
-      break;
-    }
-
-    case MouseRelease: {
-      win->PerformMouseRelease(win);
-      win->DispatchMouseHover();
-      break;
-    }
-
-    default:
-      break;
-  }
+  event.modifiers = mods;
 
+  FindWindow(window)->PostInputEvent(event);
 }
 
 void Window::CbCursorPos (GLFWwindow* window, double xpos, double ypos)
 {
-  Window* win = 0;
-  std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
-  if (it != kSharedWindowMap.end()) {
-    win = it->second;
-  } else {
-    win = dynamic_cast<Window*>(main_window());
-  }
-
-  DBG_ASSERT(win);
-
-  kCursor.reset((int) xpos, win->size().height() - (int) ypos);
-
-  kMouseAction = MouseMove;
-  kMouseButton = MouseButtonNone;
-
-  switch (kMouseAction) {
-
-    case MouseMove: {
-      win->DispatchMouseHover();
-      win->PerformMouseMove(win);
-      break;
-    }
-
-    case MousePress: {
-      win->DispatchMouseHover();
-      win->PerformMousePress(win);
-      break;
-    }
-
-    case MouseRelease: {
-      win->PerformMouseRelease(win);
-      win->DispatchMouseHover();
-      break;
-    }
-
-    default:
-      break;
-  }
+  Window* win = FindWindow(window);
 
+  InputEvent event(InputEventCursor);
+  event.cursor.reset((int) xpos, win->input_height_ - (int) ypos);
+  win->PostInputEvent(event);
 }
 
 #ifdef __APPLE__
@@ -681,15 +711,9 @@ void Window::CbCursorPos (GLFWwindow* window, double xpos, double ypos)
 // MUST set this callback to render the context when resizing in OSX
 void Window::CbWindowRefresh (GLFWwindow* window)
 {
-  Window* win = 0;
-  std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
-  if(it != kSharedWindowMap.end()) {
-    win = it->second;
-  } else {
-    win = dynamic_cast<Window*>(main_window());
-  }
+  Window* win = FindWindow(window);
 
-  DBG_ASSERT(win);
+  win->ProcessInputEvents();
 
   win->set_refresh(false);
   if (win->PreDraw(win)) {
@@ -704,17 +728,7 @@ void Window::CbWindowRefresh (GLFWwindow* window)
 
 void Window::CbClose (GLFWwindow* window)
 {
-  Window* win = 0;
-  std::map<GLFWwindow*, Window*>::iterator it = kSharedWindowMap.find(window);
-  if (it != kSharedWindowMap.end()) {
-    win = it->second;
-  } else {
-    win = dynamic_cast<Window*>(main_window());
-  }
-
-  DBG_ASSERT(win);
-
-  win->Close();
+  FindWindow(window)->Close();
 }
 
 void Window::CreateCursors ()
@@ -231,7 +231,7 @@ void Workspace::SetHeaderFrame (Frame* header, bool append)
   if (append) {
 
     if (PushBackSubView(header_frame_)) {
-      Size prefer = header_frame_->GetPreferredSize();
+      Size prefer = header_frame_->GetCachedPreferredSize();
       ResizeSubView(header_frame_, size().width(), prefer.height());
       ResizeSubView(splitter_, size().width(),
                     size().height() - prefer.height());
@@ -246,7 +246,7 @@ void Workspace::SetHeaderFrame (Frame* header, bool append)
   } else {
 
     if (PushFrontSubView(header_frame_)) {
-      Size prefer = header_frame_->GetPreferredSize();
+      Size prefer = header_frame_->GetCachedPreferredSize();
       ResizeSubView(header_frame_, size().width(), prefer.height());
       ResizeSubView(splitter_, size().width(),
                     size().height() - prefer.height());
@@ -292,7 +292,7 @@ void Workspace::SwitchHeaderPosition ()
 bool Workspace::IsExpandX () const
 {
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandX()) return true;
+    if (p->IsCachedExpandX()) return true;
   }
 
   return false;
@@ -301,7 +301,7 @@ bool Workspace::IsExpandX () const
 bool Workspace::IsExpandY () const
 {
   for (AbstractView* p = first(); p; p = next(p)) {
-    if (p->IsExpandY()) return true;
+    if (p->IsCachedExpandY()) return true;
   }
 
   return false;
@@ -316,7 +316,7 @@ Size Workspace::GetPreferredSize () const
   } else {
     Size tmp;
     for (AbstractView* p = first(); p; p = next(p)) {
-      tmp = p->GetPreferredSize();
+      tmp = p->GetCachedPreferredSize();
       prefer.set_width(std::max(prefer.width(), tmp.width()));
       prefer.set_height(prefer.height() + tmp.height());
     }
@@ -352,7 +352,7 @@ void Workspace::PerformSizeUpdate (const AbstractView* source, const AbstractVie
 
     if (header_frame_) {
 
-      Size prefer = header_frame_->GetPreferredSize();
+      Size prefer = header_frame_->GetCachedPreferredSize();
 
       ResizeSubView(header_frame_, size().width(), prefer.height());
       ResizeSubView(splitter_, size().width(),
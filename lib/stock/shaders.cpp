@@ -278,6 +278,39 @@ const char* Shaders::widget_simple_triangle_fragment_shader =
 
 // ---------------------------------------------------------------
 
+const char* Shaders::widget_stripe_vertex_shader =
+    "#version 330\n"
+    ""
+    "layout(location=0) in vec2 aCoord;"
+    "layout(location=2) in vec2 aInstance;"	// y offset and gamma of each stripe
+    "layout (std140) uniform WidgetMatrices {"
+    "	mat4 projection;"
+    "	mat4 view;"
+    "	mat3 model;"
+    "};"
+    ""
+    "flat out float StripeGamma;"
+    ""
+    "void main(void) {"
+    "	vec3 point = model * vec3(aCoord.x, aCoord.y + aInstance.x, 1.f);"
+    "	gl_Position = projection * view * vec4(point.xy, 0.f, 1.f);"
+    "	StripeGamma = aInstance.y;"
+    "}";
+
+const char* Shaders::widget_stripe_fragment_shader =
+    "#version 330\n"
+    ""
+    "flat in float StripeGamma;"
+    "uniform vec4 uColor;"
+    "out vec4 FragmentColor;"
+    ""
+    "void main(void) {"
+    "	vec4 color_calib = vec4(vec3(clamp(StripeGamma/255.0, -1.0, 1.0)), 0.0);"
+    "	FragmentColor = uColor + color_calib;"
+    "}";
+
+// ---------------------------------------------------------------
+
 const char* Shaders::widget_inner_vertex_shader =
     "#version 330\n"
     ""
@@ -1011,6 +1044,7 @@ Shaders::Shaders ()
   primitive_program_.reset(new GLSLProgram);
   widget_triangle_program_.reset(new GLSLProgram);
   widget_simple_triangle_program_.reset(new GLSLProgram);
+  widget_stripe_program_.reset(new GLSLProgram);
   widget_inner_program_.reset(new GLSLProgram);
   widget_split_inner_program_.reset(new GLSLProgram);
   widget_outer_program_.reset(new GLSLProgram);
@@ -1186,6 +1220,7 @@ bool Shaders::Setup ()
   if (!SetupWidgetTextProgram()) return false;
   if (!SetupWidgetTriangleProgram()) return false;
   if (!SetupWidgetSimpleTriangleProgram()) return false;
+  if (!SetupWidgetStripeProgram()) return false;
   if (!SetupWidgetImageProgram()) return false;
   if (!SetupWidgetLineProgram()) return false;
   if (!SetupWidgetShadowProgram()) return false;
@@ -1317,6 +1352,13 @@ bool Shaders::Setup ()
   glUniformBlockBinding(widget_simple_triangle_program_->id(), block_index,
                         kWidgetMatricesBindingPoint);
 
+  // set uniform block for stripe program
+
+  block_index = glGetUniformBlockIndex(widget_stripe_program_->id(),
+                                       "WidgetMatrices");
+  glUniformBlockBinding(widget_stripe_program_->id(), block_index,
+                        kWidgetMatricesBindingPoint);
+
   // set uniform block in image program
 
   block_index = glGetUniformBlockIndex(widget_image_program_->id(),
@@ -1608,6 +1650,32 @@ bool Shaders::SetupWidgetSimpleTriangleProgram ()
   return true;
 }
 
+bool Shaders::SetupWidgetStripeProgram ()
+{
+  if (!widget_stripe_program_->Create()) {
+    return false;
+  }
+
+  widget_stripe_program_->AttachShader(widget_stripe_vertex_shader,
+                                       GL_VERTEX_SHADER);
+  widget_stripe_program_->AttachShader(widget_stripe_fragment_shader,
+                                       GL_FRAGMENT_SHADER);
+  if (!widget_stripe_program_->Link()) {
+    DBG_PRINT_MSG("Fail to link the widget stripe program: %d",
+                  widget_stripe_program_->id());
+    return false;
+  }
+
+  locations_[WIDGET_STRIPE_COORD] =
+      widget_stripe_program_->GetAttributeLocation("aCoord");
+  locations_[WIDGET_STRIPE_INSTANCE] =
+      widget_stripe_program_->GetAttributeLocation("aInstance");
+  locations_[WIDGET_STRIPE_COLOR] =
+      widget_stripe_program_->GetUniformLocation("uColor");
+
+  return true;
+}
+
 bool Shaders::SetupWidgetImageProgram ()
 {
   if (!widget_image_program_->Create()) {